@@ -0,0 +1,194 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../s21_containers/s21_containers.h"
+#include "../s21_containers/setMap/small/s21_small_map.tpp"
+#include "../s21_containers/setMap/small/s21_small_set.tpp"
+
+// Counts heap allocations, key copies and key comparisons per operation of
+// the AVL engine behind s21::set and s21::map, and of small_set and
+// small_map on short-lived scratch sets.
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+  ++allocations;
+  void* ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+struct Counters {
+  size_t copies = 0;
+  size_t comparisons = 0;
+};
+static Counters counters;
+
+class CountedKey {
+ public:
+  CountedKey() = default;
+  explicit CountedKey(std::string value) : value_(std::move(value)) {}
+  CountedKey(const CountedKey& other) : value_(other.value_) {
+    ++counters.copies;
+  }
+  CountedKey(CountedKey&& other) noexcept = default;
+  CountedKey& operator=(const CountedKey& other) {
+    ++counters.copies;
+    value_ = other.value_;
+    return *this;
+  }
+  CountedKey& operator=(CountedKey&& other) noexcept = default;
+
+  bool operator<(const CountedKey& other) const {
+    ++counters.comparisons;
+    return value_ < other.value_;
+  }
+  bool operator>(const CountedKey& other) const {
+    ++counters.comparisons;
+    return value_ > other.value_;
+  }
+  bool operator<=(const CountedKey& other) const {
+    ++counters.comparisons;
+    return value_ <= other.value_;
+  }
+  bool operator==(const CountedKey& other) const {
+    ++counters.comparisons;
+    return value_ == other.value_;
+  }
+
+ private:
+  std::string value_;
+};
+
+static std::vector<CountedKey> MakeKeys(size_t n) {
+  std::vector<CountedKey> keys;
+  keys.reserve(n);
+  unsigned state = 12345;
+  for (size_t i = 0; i < n; i++) {
+    state = state * 1103515245u + 12345u;
+    keys.emplace_back("key-with-a-long-prefix-" + std::to_string(state));
+  }
+  return keys;
+}
+
+template <typename Op>
+static void Measure(const char* name, size_t ops, Op op) {
+  counters = Counters();
+  size_t allocations_before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  op();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf(
+      "%-24s %8.2f allocs/op %8.2f copies/op %8.2f cmps/op %10.1f ns/op\n",
+      name, double(allocations - allocations_before) / ops,
+      double(counters.copies) / ops, double(counters.comparisons) / ops,
+      ns / ops);
+}
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  size_t map_n = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : n;
+  std::vector<CountedKey> keys = MakeKeys(n);
+
+  s21::set<CountedKey> set;
+  Measure("set insert", n, [&] {
+    for (const auto& key : keys) set.insert(key);
+  });
+  Measure("set insert (present)", n, [&] {
+    for (const auto& key : keys) set.insert(key);
+  });
+  Measure("set find", n, [&] {
+    for (const auto& key : keys) set.find(key);
+  });
+  Measure("set erase", n, [&] {
+    for (const auto& key : keys) set.erase(set.find(key));
+  });
+
+  s21::map<CountedKey, int> map;
+  Measure("map insert", map_n, [&] {
+    for (size_t i = 0; i < map_n; i++) map.insert(keys[i], int(i));
+  });
+  Measure("map at", map_n, [&] {
+    for (size_t i = 0; i < map_n; i++) map.at(keys[i]);
+  });
+
+  s21::set<int> numbers;
+  Measure("set<int> insert", n, [&] {
+    for (size_t i = 0; i < n; i++) numbers.insert(int(i * 7919 % n));
+  });
+  Measure("set<int> clear", n, [&] { numbers.clear(); });
+
+  std::vector<int> sorted(n);
+  for (size_t i = 0; i < n; i++) sorted[i] = int(i);
+  std::vector<int> shuffled(n);
+  for (size_t i = 0; i < n; i++) shuffled[i] = int(i * 7919 % n);
+  Measure("set<int> sorted build", n, [&] {
+    s21::set<int> built(sorted.begin(), sorted.end());
+  });
+  Measure("set<int> hinted insert", n, [&] {
+    s21::set<int> built;
+    for (int key : sorted) built.insert(built.end(), key);
+  });
+  Measure("set<int> unsorted build", n, [&] {
+    s21::set<int> built(shuffled.begin(), shuffled.end());
+  });
+
+  // A large set combined with one a hundred times smaller, per small key
+  size_t small_n = n / 100 + 1;
+  std::vector<int> small(small_n);
+  for (size_t i = 0; i < small_n; i++) small[i] = int(i * 7919 * 100 % n);
+  s21::set<int> big(sorted.begin(), sorted.end());
+  Measure("set<int> union (n/100)", small_n, [&] {
+    s21::set<int> other(small.begin(), small.end());
+    big.set_union(other);
+  });
+  Measure("set<int> difference", small_n, [&] {
+    s21::set<int> other(small.begin(), small.end());
+    big.set_difference(other);
+  });
+  // Moves every other key of map into a second map, then back by merge
+  s21::map<CountedKey, int> half;
+  for (size_t i = 0; i < map_n; i += 2) half.insert(map.extract(keys[i]));
+  Measure("map merge", map_n / 2, [&] { map.merge(half); });
+  Measure("map clear", n, [&] { map.clear(); });
+
+  // Short-lived scratch sets of 8 keys, per set built, filled, searched
+  // and destroyed
+  size_t scratch_n = n / 8;
+  Measure("scratch set<int> x8", scratch_n, [&] {
+    for (size_t i = 0; i < scratch_n; i++) {
+      s21::set<int> scratch;
+      for (size_t j = 0; j < 8; j++) scratch.insert(shuffled[i * 8 + j]);
+      scratch.contains(shuffled[i]);
+    }
+  });
+  Measure("scratch map<int,int> x8", scratch_n, [&] {
+    for (size_t i = 0; i < scratch_n; i++) {
+      s21::map<int, int> scratch;
+      for (size_t j = 0; j < 8; j++) scratch[shuffled[i * 8 + j]] = int(j);
+      scratch.contains(shuffled[i]);
+    }
+  });
+  Measure("scratch small_set x8", scratch_n, [&] {
+    for (size_t i = 0; i < scratch_n; i++) {
+      s21::small_set<int> scratch;
+      for (size_t j = 0; j < 8; j++) scratch.insert(shuffled[i * 8 + j]);
+      scratch.contains(shuffled[i]);
+    }
+  });
+  Measure("scratch small_map x8", scratch_n, [&] {
+    for (size_t i = 0; i < scratch_n; i++) {
+      s21::small_map<int, int> scratch;
+      for (size_t j = 0; j < 8; j++) scratch[shuffled[i * 8 + j]] = int(j);
+      scratch.contains(shuffled[i]);
+    }
+  });
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../s21_containers/s21_containers.h"
+#include "../s21_containers/s21_containersplus.h"
+
+// Nanoseconds per operation of the AVL s21::set / s21::map against the
+// B-tree btree_set / btree_map for int keys, at sizes from 1e4 up to the
+// size given on the command line (1e8 needs several GB for the AVL tree).
+
+// Lookup hits are summed here so that the lookups cannot be optimized away
+static size_t hits = 0;
+
+template <typename Op>
+static double Measure(size_t ops, Op op) {
+  auto start = std::chrono::steady_clock::now();
+  op();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Set>
+static void RunSet(const char* name, const std::vector<int>& keys,
+                   const std::vector<int>& sorted) {
+  size_t n = keys.size();
+  Set set;
+  double insert = Measure(n, [&] {
+    for (int key : keys) set.insert(key);
+  });
+  double find = Measure(n, [&] {
+    for (int key : keys) hits += set.contains(key + 1);
+  });
+  double walk = Measure(n, [&] {
+    for (int key : set) hits += key & 1;
+  });
+  double erase = Measure(n, [&] {
+    for (int key : keys) {
+      auto it = set.find(key);
+      if (it != set.end()) set.erase(it);
+    }
+  });
+  double build = Measure(n, [&] {
+    Set built(sorted.begin(), sorted.end());
+    hits += built.size();
+  });
+  std::printf("%-12s %10zu %9.1f %9.1f %9.1f %9.1f %9.1f\n", name, n, insert,
+              find, walk, erase, build);
+}
+
+template <typename Map>
+static void RunMap(const char* name, const std::vector<int>& keys) {
+  size_t n = keys.size();
+  Map map;
+  double insert = Measure(n, [&] {
+    for (int key : keys) map.insert(key, key);
+  });
+  double at = Measure(n, [&] {
+    for (int key : keys) hits += map.at(key);
+  });
+  double assign = Measure(n, [&] {
+    for (int key : keys) map.insert_or_assign(key, -key);
+  });
+  std::printf("%-12s %10zu %9.1f %9.1f %9.1f\n", name, n, insert, at, assign);
+}
+
+// Keys are random: keys in insertion order would find the AVL nodes
+// next to each other in memory and hide its cache misses
+static std::vector<int> RandomKeys(size_t n) {
+  std::vector<int> keys(n);
+  unsigned state = 12345;
+  for (size_t i = 0; i < n; i++) {
+    state = state * 1103515245u + 12345u;
+    // even keys, so that find of key + 1 misses half of the time
+    keys[i] = int(state & ~1u);
+  }
+  return keys;
+}
+
+int main(int argc, char* argv[]) {
+  size_t max_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-12s %10s %9s %9s %9s %9s %9s\n", "set<int>", "n", "insert",
+              "find", "walk", "erase", "build");
+  for (size_t n = 10000; n <= max_n; n *= 10) {
+    std::vector<int> keys = RandomKeys(n);
+    std::vector<int> sorted(n);
+    for (size_t i = 0; i < n; i++) sorted[i] = int(i * 2);
+    RunSet<s21::set<int>>("avl", keys, sorted);
+    RunSet<s21::btree_set<int>>("btree", keys, sorted);
+  }
+  std::printf("\n%-12s %10s %9s %9s %9s\n", "map<int,int>", "n", "insert",
+              "at", "assign");
+  for (size_t n = 10000; n <= max_n; n *= 10) {
+    std::vector<int> keys = RandomKeys(n);
+    RunMap<s21::map<int, int>>("avl", keys);
+    RunMap<s21::btree_map<int, int>>("btree", keys);
+  }
+  std::printf("(%zu hits)\n", hits);
+  return 0;
+}
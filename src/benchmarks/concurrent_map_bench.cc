@@ -0,0 +1,87 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers/s21_containers.h"
+#include "../s21_containers/s21_containersplus.h"
+
+// Throughput of s21::concurrent_map against one s21::map behind a single
+// mutex, from 1 to 64 threads. Every thread runs the same mix over a
+// shared key range: 80% lookups, 10% inserts and 10% erases.
+
+class LockedMap {
+ public:
+  bool contains(int key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) map_.erase(it);
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable s21::map<int, int> map_;
+};
+
+// Lookup hits are summed here so that the lookups cannot be optimized away
+static std::atomic<size_t> hits(0);
+
+template <typename Map>
+static void Worker(Map& map, unsigned seed, size_t ops, int range) {
+  size_t found = 0;
+  for (size_t i = 0; i < ops; i++) {
+    seed = seed * 1103515245u + 12345u;
+    int key = int((seed >> 8) % unsigned(range));
+    unsigned op = (seed >> 4) % 10;
+    if (op == 0) {
+      map.insert(key, key);
+    } else if (op == 1) {
+      map.erase(key);
+    } else {
+      found += map.contains(key);
+    }
+  }
+  hits += found;
+}
+
+template <typename Map>
+static double Run(Map& map, size_t threads, size_t ops, int range) {
+  for (int key = 0; key < range; key += 2) map.insert(key, key);
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < threads; t++) {
+    pool.emplace_back([&map, t, ops, range] {
+      Worker(map, unsigned(t + 1) * 2654435761u, ops, range);
+    });
+  }
+  for (auto& thread : pool) thread.join();
+  auto stop = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  return double(threads * ops) / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+  size_t ops = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+  int range = argc > 2 ? std::atoi(argv[2]) : 100000;
+  std::printf("%-8s %16s %16s\n", "threads", "mutex Mops/s",
+              "sharded Mops/s");
+  for (size_t threads = 1; threads <= 64; threads *= 2) {
+    LockedMap locked;
+    s21::concurrent_map<int, int> sharded;
+    double base = Run(locked, threads, ops, range);
+    double split = Run(sharded, threads, ops, range);
+    std::printf("%-8zu %16.2f %16.2f\n", threads, base, split);
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers/s21_containers.h"
+#include "../s21_containers/s21_containersplus.h"
+
+// Throughput of the lock-free s21::concurrent_set against one s21::set
+// behind a single mutex, from 1 to 64 threads, for a read-heavy and a
+// write-heavy mix of lookups, inserts and erases over a shared key range.
+
+class LockedSet {
+ public:
+  bool contains(int key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return set_.contains(key);
+  }
+  void insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    set_.insert(key);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = set_.find(key);
+    if (it != set_.end()) set_.erase(it);
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable s21::set<int> set_;
+};
+
+// writes is the share of updates in percent, half inserts and half erases
+// Lookup hits are summed here so that the lookups cannot be optimized away
+static std::atomic<size_t> hits(0);
+
+template <typename Set>
+static void Worker(Set& set, unsigned seed, size_t ops, int range,
+                   unsigned writes) {
+  size_t found = 0;
+  for (size_t i = 0; i < ops; i++) {
+    seed = seed * 1103515245u + 12345u;
+    int key = int((seed >> 8) % unsigned(range));
+    unsigned op = (seed >> 4) % 100;
+    if (op < writes / 2) {
+      set.insert(key);
+    } else if (op < writes) {
+      set.erase(key);
+    } else {
+      found += set.contains(key);
+    }
+  }
+  hits += found;
+}
+
+template <typename Set>
+static double Run(size_t threads, size_t ops, int range, unsigned writes) {
+  Set set;
+  for (int key = 0; key < range; key += 2) set.insert(key);
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < threads; t++) {
+    pool.emplace_back([&set, t, ops, range, writes] {
+      Worker(set, unsigned(t + 1) * 2654435761u, ops, range, writes);
+    });
+  }
+  for (auto& thread : pool) thread.join();
+  auto stop = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  return double(threads * ops) / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+  size_t ops = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+  int range = argc > 2 ? std::atoi(argv[2]) : 100000;
+  for (unsigned writes : {10u, 50u}) {
+    std::printf("%u%% writes\n%-8s %16s %16s\n", writes, "threads",
+                "mutex Mops/s", "lock-free Mops/s");
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+      double locked = Run<LockedSet>(threads, ops, range, writes);
+      double lock_free =
+          Run<s21::concurrent_set<int>>(threads, ops, range, writes);
+      std::printf("%-8zu %16.2f %16.2f\n", threads, locked, lock_free);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <chrono>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <cstdio>
+#include <unordered_set>
+#include <vector>
+
+#include "../s21_containers/s21_containers.h"
+#include "../s21_containers/s21_containersplus.h"
+
+// s21::set, std::unordered_set and the Swiss-table s21::unordered_set with
+// random int keys: nanoseconds per insert and per lookup (half of them
+// miss), and the slowest single insert, where a rehash all at once shows
+// up as a spike that incremental migration spreads out.
+
+// Lookup hits are summed here so that the lookups cannot be optimized away
+static size_t hits = 0;
+
+using Clock = std::chrono::steady_clock;
+
+static double Nanos(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+template <typename Set>
+static void Run(const char* name, const std::vector<int>& keys) {
+#ifdef __GLIBC__
+  // The nodes freed by the last run would otherwise be consolidated
+  // inside the first large allocation of this one, and time as its spike
+  malloc_trim(0);
+#endif
+  size_t n = keys.size();
+  Set set;
+  double worst = 0;
+  auto start = Clock::now();
+  for (int key : keys) {
+    auto before = Clock::now();
+    set.insert(key);
+    double took = Nanos(before, Clock::now());
+    if (took > worst) worst = took;
+  }
+  // the clock reads are part of the total, the same for every set
+  double insert = Nanos(start, Clock::now()) / n;
+  start = Clock::now();
+  for (int key : keys) {
+    hits += set.find(key + 1) != set.end();
+    hits += set.find(key) != set.end();
+  }
+  double find = Nanos(start, Clock::now()) / (2 * n);
+  std::printf("%-16s %10zu %9.1f %9.1f %12.0f\n", name, n, insert, find,
+              worst);
+}
+
+static std::vector<int> RandomKeys(size_t n) {
+  std::vector<int> keys(n);
+  unsigned state = 12345;
+  for (size_t i = 0; i < n; i++) {
+    state = state * 1103515245u + 12345u;
+    // even keys, so that find of key + 1 misses
+    keys[i] = int(state & ~1u);
+  }
+  return keys;
+}
+
+int main() {
+  std::printf("%-16s %10s %9s %9s %12s\n", "set<int>", "n", "insert", "find",
+              "worst insert");
+  for (size_t n = 10000; n <= 1000000; n *= 10) {
+    std::vector<int> keys = RandomKeys(n);
+    Run<s21::set<int>>("avl", keys);
+    Run<std::unordered_set<int>>("std::unordered", keys);
+    Run<s21::unordered_set<int>>("swiss", keys);
+  }
+  std::printf("(%zu hits)\n", hits);
+  return 0;
+}
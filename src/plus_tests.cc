@@ -1,6 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "./s21_containers/s21_containersplus.h"
 
@@ -223,6 +232,1117 @@ TEST(ArrayTest, OperatorBracket) {
   EXPECT_EQ(arr[2], 10);
 }
 
+TEST(CompactSetTest, InsertFindErase) {
+  s21::compact_set<int> s = {5, 3, 8, 1, 4};
+  EXPECT_EQ(s.size(), 5);
+  EXPECT_FALSE(s.insert(3).second);
+  EXPECT_TRUE(s.insert(7).second);
+  EXPECT_TRUE(s.contains(7));
+  EXPECT_EQ(*s.find(4), 4);
+  EXPECT_EQ(s.find(42), s.end());
+  s.erase(s.find(5));
+  EXPECT_FALSE(s.contains(5));
+  EXPECT_EQ(s.size(), 5);
+}
+
+TEST(CompactSetTest, MatchesStdSet) {
+  s21::compact_set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 2000; i++) {
+    int key = (i * 7919) % 1009;
+    s.insert(key);
+    expected.insert(key);
+  }
+  for (int i = 0; i < 1009; i += 3) {
+    s.erase(s.find(i));
+    expected.erase(i);
+  }
+  for (int i = 2000; i < 2100; i++) {
+    s.insert(i);
+    expected.insert(i);
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  size_t k = 0;
+  for (int key : expected) {
+    EXPECT_EQ(*it, key);
+    EXPECT_EQ(*s.select(k), key);
+    EXPECT_EQ(s.rank(key), k);
+    ++it;
+    ++k;
+  }
+  EXPECT_EQ(it, s.end());
+  EXPECT_EQ(*--s.end(), 2099);
+}
+
+TEST(CompactSetTest, CopyMoveSwap) {
+  s21::compact_set<std::string> s1 = {"b", "a", "c"};
+  s21::compact_set<std::string> s2(s1);
+  EXPECT_EQ(s2.size(), 3);
+  EXPECT_EQ(*s2.begin(), "a");
+  s21::compact_set<std::string> s3(std::move(s1));
+  EXPECT_EQ(s3.size(), 3);
+  s21::compact_set<std::string> s4 = {"z"};
+  s4.swap(s3);
+  EXPECT_EQ(s4.size(), 3);
+  EXPECT_TRUE(s3.contains("z"));
+  s4.merge(s3);
+  EXPECT_EQ(s4.size(), 4);
+  EXPECT_TRUE(s3.empty());
+  s4.clear();
+  EXPECT_TRUE(s4.empty());
+}
+
+TEST(CompactSetTest, TransparentFind) {
+  s21::compact_set<std::string, std::less<>> s = {"alpha", "beta"};
+  EXPECT_TRUE(s.contains("beta"));
+  EXPECT_EQ(s.find("gamma"), s.end());
+}
+
+TEST(CompactMapTest, Access) {
+  s21::compact_map<int, std::string> m = {{1, "one"}, {2, "two"}};
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_THROW(m.at(3), std::invalid_argument);
+  m[3] = "three";
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_FALSE(m.insert(1, "ONE").second);
+  EXPECT_EQ(m.at(1), "one");
+  auto result = m.insert_or_assign(1, "ONE");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, "ONE");
+  m.erase(m.find(2));
+  EXPECT_FALSE(m.contains(2));
+  int expected[] = {1, 3};
+  int i = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    EXPECT_EQ(it->first, expected[i++]);
+  }
+}
+
+TEST(CompactMapTest, GrowKeepsEntries) {
+  s21::compact_map<int, std::string> m;
+  for (int i = 0; i < 1000; i++) m[i] = std::to_string(i);
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(m.at(i), std::to_string(i));
+  s21::compact_map<int, std::string> copy(m);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy.at(999), "999");
+}
+
+TEST(MultisetTest, MatchesStdMultiset) {
+  s21::multiset<int> ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 3000; i++) {
+    int key = (i * 7919) % 101;
+    if (i % 5 == 4) {
+      EXPECT_EQ(ms.erase(key), expected.erase(key));
+    } else if (i % 5 == 3 && ms.contains(key)) {
+      ms.erase(ms.find(key));
+      expected.erase(expected.find(key));
+    } else {
+      ms.insert(key);
+      expected.insert(key);
+    }
+    ASSERT_EQ(ms.size(), expected.size());
+    ASSERT_EQ(ms.count(key), expected.count(key));
+  }
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin()));
+  for (int key = -1; key <= 101; key++) {
+    auto range = ms.equal_range(key);
+    auto std_range = expected.equal_range(key);
+    EXPECT_EQ(s21::distance(range.first, range.second),
+              std::distance(std_range.first, std_range.second));
+    EXPECT_EQ(ms.count_less(key), size_t(std::distance(
+                                      expected.begin(), std_range.first)));
+  }
+}
+TEST(MultisetTest, EqualKeysKeepInsertionOrder) {
+  struct ByFirst {
+    bool operator()(const std::pair<int, int>& a,
+                    const std::pair<int, int>& b) const {
+      return a.first < b.first;
+    }
+  };
+  s21::multiset<std::pair<int, int>, ByFirst> ms;
+  for (int i = 0; i < 50; i++) ms.insert({i % 3, i});
+  ms.emplace(1, 100);
+  auto range = ms.equal_range({1, 0});
+  int previous = -1;
+  size_t copies = 0;
+  for (auto it = range.first; it != range.second; ++it, ++copies) {
+    EXPECT_EQ(it->first, 1);
+    EXPECT_GT(it->second, previous);
+    previous = it->second;
+  }
+  EXPECT_EQ(copies, 18U);
+  EXPECT_EQ(ms.find({1, 0})->second, 1);
+  EXPECT_EQ(ms.erase({1, 0}), 18U);
+  EXPECT_EQ(ms.size(), 33U);
+  EXPECT_EQ(ms.count({1, 0}), 0U);
+  // the range constructor sorts stably before linking the nodes
+  std::vector<std::pair<int, int>> pairs;
+  for (int i = 0; i < 50; i++) pairs.push_back({(50 - i) % 3, i});
+  s21::multiset<std::pair<int, int>, ByFirst> built(pairs.begin(),
+                                                   pairs.end());
+  EXPECT_EQ(built.count({2, 0}), 17U);
+  auto it = built.begin();
+  for (int i = 1; i < 50; i++) {
+    auto next = std::next(it);
+    EXPECT_TRUE(it->first < next->first || it->second < next->second);
+    it = next;
+  }
+  EXPECT_EQ(built.nth(17)->first, 1);
+  built.insert({1, 100});
+  EXPECT_EQ(std::prev(built.upper_bound({1, 0}))->second, 100);
+}
+TEST(MultisetTest, AscendingTimestamps) {
+  std::vector<long> stamps;
+  for (long t = 0; t < 10000; t++) stamps.push_back(t / 4);
+  s21::multiset<long> index(stamps.begin(), stamps.end());
+  EXPECT_EQ(index.size(), 10000U);
+  EXPECT_EQ(index.count(1234), 4U);
+  EXPECT_EQ(*index.nth(4937), 1234);
+  for (long t = 0; t < 100; t++) index.insert(2500);
+  EXPECT_EQ(index.count(2500), 100U);
+  EXPECT_EQ(index.erase(2500), 100U);
+  EXPECT_EQ(index.erase(2500), 0U);
+  EXPECT_EQ(*--index.end(), 2499);
+}
+TEST(MultisetTest, MergeAndNodeHandles) {
+  s21::multiset<std::string> a = {"b", "a", "b"};
+  s21::multiset<std::string> b = {"b", "c"};
+  const std::string* moved = &*b.find("c");
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 5U);
+  EXPECT_EQ(a.count("b"), 3U);
+  EXPECT_EQ(&*a.find("c"), moved);
+  auto node = a.extract("b");
+  EXPECT_EQ(node.value(), "b");
+  EXPECT_EQ(a.count("b"), 2U);
+  b.insert(std::move(node));
+  b.insert(a.extract(a.begin()));
+  EXPECT_EQ(b.size(), 2U);
+  EXPECT_EQ(*b.begin(), "a");
+  s21::multiset<std::string> copy(a);
+  a.clear();
+  EXPECT_EQ(copy.count("b"), 2U);
+  auto result = copy.insert_many("b", "d");
+  EXPECT_EQ(*result[1].first, "d");
+  EXPECT_EQ(copy.count("b"), 3U);
+}
+
+TEST(IntervalMapTest, OverlapQueriesMatchScan) {
+  s21::interval_map<int, int> leases;
+  std::vector<std::pair<std::pair<int, int>, int>> all;
+  for (int i = 0; i < 400; i++) {
+    int lo = (i * 7919) % 1000;
+    int hi = lo + 1 + (i * 31) % 40;
+    // distinct values, so nothing is coalesced
+    leases.insert(lo, hi, i);
+    all.push_back({{lo, hi}, i});
+  }
+  EXPECT_EQ(leases.size(), 400U);
+  for (int a = -10; a < 1050; a += 17) {
+    int b = a + (a % 5) * 9 + 1;
+    std::multiset<std::pair<int, int>> expected;
+    for (const auto& entry : all) {
+      if (entry.first.first < b && a < entry.first.second) {
+        expected.insert(entry.first);
+      }
+    }
+    auto found = leases.overlapping(a, b);
+    ASSERT_EQ(found.size(), expected.size());
+    for (size_t i = 1; i < found.size(); i++) {
+      EXPECT_FALSE(found[i]->first < found[i - 1]->first);
+    }
+    std::multiset<std::pair<int, int>> got;
+    for (auto it : found) got.insert(it->first);
+    EXPECT_EQ(got, expected);
+    EXPECT_EQ(leases.overlaps(a, b), !expected.empty());
+    size_t points = 0;
+    for (const auto& entry : all) {
+      points += entry.first.first <= a && a < entry.first.second;
+    }
+    EXPECT_EQ(leases.containing(a).size(), points);
+  }
+  leases.erase(leases.begin());
+  EXPECT_EQ(leases.size(), 399U);
+}
+TEST(IntervalMapTest, CoalescesEqualValues) {
+  s21::interval_map<int, std::string> m = {{{0, 5}, "a"}, {{10, 15}, "a"}};
+  m.insert(20, 25, "b");
+  EXPECT_EQ(m.size(), 3U);
+  // touches both "a" entries: all three become one
+  auto it = m.insert(5, 10, "a");
+  EXPECT_EQ(it->first, std::make_pair(0, 15));
+  EXPECT_EQ(m.size(), 2U);
+  // overlaps, but with another value
+  m.insert(12, 22, "c");
+  EXPECT_EQ(m.size(), 3U);
+  m.insert(24, 30, "b");
+  EXPECT_EQ(m.size(), 3U);
+  EXPECT_EQ((--m.end())->first, std::make_pair(20, 30));
+  EXPECT_EQ(m.insert(7, 7, "a"), m.end());
+  EXPECT_EQ(m.containing(14).size(), 2U);
+  EXPECT_TRUE(m.containing(15).size() == 1U);
+  EXPECT_TRUE(m.overlapping(30, 40).empty());
+  std::vector<std::string> values;
+  for (const auto& entry : m) values.push_back(entry.second);
+  EXPECT_EQ(values, (std::vector<std::string>{"a", "c", "b"}));
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_FALSE(m.overlaps(0, 100));
+}
+
+// Ascending or descending, chosen per object
+struct Direction {
+  bool descending = false;
+  bool operator()(int a, int b) const { return descending ? b < a : a < b; }
+};
+TEST(IntervalMapTest, OrderComesFromTheComparator) {
+  // intervals run from lo down to hi
+  s21::interval_map<int, int, Direction> down(Direction{true});
+  down.insert(10, 5, 1);
+  down.insert(30, 20, 2);
+  EXPECT_EQ(down.insert(5, 5, 1), down.end());
+  EXPECT_EQ(down.begin()->first, std::make_pair(30, 20));
+  EXPECT_EQ(down.containing(7).size(), 1U);
+  EXPECT_TRUE(down.containing(12).empty());
+  EXPECT_EQ(down.overlapping(25, 8).size(), 2U);
+  auto it = down.insert(5, 0, 1);
+  EXPECT_EQ(it->first, std::make_pair(10, 0));
+  EXPECT_EQ(down.size(), 2U);
+  EXPECT_TRUE(down.key_comp().descending);
+  // the greatest end in order, not in value, and none for an empty map
+  s21::interval_map<int, int, std::greater<int>> greater;
+  EXPECT_FALSE(greater.get_tree().Aggregate().has_value());
+  greater.insert(10, 5, 1);
+  greater.insert(3, -4, 2);
+  EXPECT_EQ(*greater.get_tree().Aggregate(), -4);
+  EXPECT_EQ(greater.containing(-1).size(), 1U);
+}
+
+TEST(PersistentSetTest, SnapshotsAreStable) {
+  s21::persistent_set<int> live = {5, 1, 3};
+  s21::persistent_set<int> before = live.snapshot();
+  auto it = live.begin();
+  for (int i = 0; i < 100; i++) live.insert(i * 2);
+  EXPECT_EQ(live.erase(3), 1U);
+  EXPECT_EQ(live.erase(3), 0U);
+  EXPECT_FALSE(live.insert(4));
+  EXPECT_EQ(live.size(), 102U);
+  EXPECT_EQ(before.size(), 3U);
+  EXPECT_TRUE(before.contains(3));
+  EXPECT_FALSE(live.contains(3));
+  // an iterator keeps walking the version it was made from
+  std::vector<int> seen;
+  for (; it != before.end(); ++it) seen.push_back(*it);
+  EXPECT_EQ(seen, (std::vector<int>{1, 3, 5}));
+  std::set<int> expected(before.begin(), before.end());
+  for (int i = 0; i < 100; i++) expected.insert(i * 2);
+  expected.erase(3);
+  EXPECT_TRUE(std::equal(live.begin(), live.end(), expected.begin()));
+  EXPECT_EQ(*live.lower_bound(51), 52);
+  EXPECT_EQ(live.find(51), live.end());
+  EXPECT_EQ(*live.find(52), 52);
+  live.clear();
+  EXPECT_TRUE(live.empty());
+  EXPECT_EQ(before.size(), 3U);
+}
+TEST(PersistentMapTest, PathCopyingSharesValues) {
+  s21::persistent_map<int, std::string> m = {{1, "a"}, {2, "b"}};
+  auto old = m.snapshot();
+  const std::string* shared = &m.at(2);
+  EXPECT_FALSE(m.insert_or_assign(1, "z"));
+  EXPECT_TRUE(m.insert(3, "c"));
+  EXPECT_FALSE(m.insert(3, "d"));
+  EXPECT_EQ(m.at(1), "z");
+  EXPECT_EQ(old.at(1), "a");
+  // untouched elements are shared between the versions, not copied
+  EXPECT_EQ(&m.at(2), shared);
+  EXPECT_EQ(&old.at(2), shared);
+  EXPECT_EQ(m.find(3)->second, "c");
+  EXPECT_THROW(old.at(3), std::invalid_argument);
+  EXPECT_EQ(m.erase(2), 1U);
+  EXPECT_EQ(old.at(2), "b");
+}
+TEST(PersistentMapTest, ReadersWhileWriting) {
+  s21::persistent_map<int, int> live;
+  std::atomic<bool> done(false);
+  std::atomic<int> bad(0);
+  auto reader = [&] {
+    while (!done) {
+      // every snapshot holds exactly the keys 0 .. size - 1
+      auto view = live.snapshot();
+      int expected = 0;
+      for (const auto& entry : view) {
+        if (entry.first != expected || entry.second != expected * 2) bad++;
+        expected++;
+      }
+      if (size_t(expected) != view.size()) bad++;
+    }
+  };
+  std::thread first(reader);
+  std::thread second(reader);
+  for (int i = 0; i < 3000; i++) live.insert(i, i * 2);
+  done = true;
+  first.join();
+  second.join();
+  EXPECT_EQ(bad, 0);
+  EXPECT_EQ(live.size(), 3000U);
+}
+
+TEST(ConcurrentMapTest, BatchesAndOrderedWalk) {
+  s21::concurrent_map<int, int> m(8);
+  EXPECT_EQ(m.shard_count(), 8U);
+  std::vector<std::pair<const int, int>> items;
+  for (int i = 99; i >= 0; i--) items.emplace_back(i, i * i);
+  EXPECT_EQ(m.insert_many(items), 100U);
+  EXPECT_FALSE(m.insert(5, 0));
+  EXPECT_FALSE(m.insert_or_assign(5, -5));
+  EXPECT_EQ(*m.find(5), -5);
+  EXPECT_TRUE(m.update(6, [](int& v) { v = 1; }));
+  EXPECT_FALSE(m.update(100, [](int& v) { v = 1; }));
+  auto found = m.find_many({7, 100, 6});
+  EXPECT_EQ(*found[0], 49);
+  EXPECT_FALSE(found[1].has_value());
+  EXPECT_EQ(*found[2], 1);
+  EXPECT_EQ(m.erase_many({0, 1, 100}), 2U);
+  EXPECT_EQ(m.erase(2), 1U);
+  EXPECT_EQ(m.erase(2), 0U);
+  int expected = 3;
+  m.for_each([&](const std::pair<const int, int>& entry) {
+    EXPECT_EQ(entry.first, expected++);
+  });
+  EXPECT_EQ(expected, 100);
+  EXPECT_EQ(m.size(), 97U);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(ConcurrentMapTest, ParallelWriters) {
+  s21::concurrent_map<int, int> m(4);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&m, t] {
+      for (int i = 0; i < 2000; i++) {
+        m.insert(t * 2000 + i, t);
+        m.update(i, [](int& v) { v += 10; });
+        m.contains(i);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(m.size(), 8000U);
+  int previous = -1;
+  m.for_each([&](const std::pair<const int, int>& entry) {
+    EXPECT_LT(previous, entry.first);
+    previous = entry.first;
+  });
+  EXPECT_EQ(*m.find(4000), 2);
+}
+
+// Orders by key modulo a base picked at run time, so it has state and no
+// default constructor
+struct ByResidue {
+  explicit ByResidue(int base) : base(base) {}
+  bool operator()(int a, int b) const {
+    return a % base != b % base ? a % base < b % base : a < b;
+  }
+  int base;
+};
+
+TEST(ConcurrentMapTest, StatefulComparator) {
+  s21::concurrent_map<int, int, ByResidue> m(4, ByResidue(3));
+  for (int i = 0; i < 9; i++) EXPECT_TRUE(m.insert(i, i * 10));
+  EXPECT_EQ(*m.find(4), 40);
+  std::vector<int> keys;
+  m.for_each([&](const std::pair<const int, int>& entry) {
+    keys.push_back(entry.first);
+  });
+  EXPECT_EQ(keys, (std::vector<int>{0, 3, 6, 1, 4, 7, 2, 5, 8}));
+}
+// Throws on the copy that uses up the budget
+struct CountedLess {
+  static int copies_left;
+  CountedLess() = default;
+  CountedLess(const CountedLess&) {
+    if (--copies_left < 0) throw std::runtime_error("no more copies");
+  }
+  CountedLess& operator=(const CountedLess&) = default;
+  bool operator()(int a, int b) const { return a < b; }
+};
+int CountedLess::copies_left = 0;
+TEST(ConcurrentMapTest, FailedShardReleasesStorage) {
+  // the copies run out part way through the shards; the ones built are
+  // destroyed and the storage of all of them is freed
+  CountedLess::copies_left = 8;
+  EXPECT_THROW((s21::concurrent_map<int, int, CountedLess>(16)),
+               std::runtime_error);
+  CountedLess::copies_left = 1000;
+  s21::concurrent_map<int, int, CountedLess> m(16);
+  EXPECT_TRUE(m.insert(1, 1));
+  EXPECT_EQ(m.shard_count(), 16U);
+}
+
+TEST(ConcurrentSetTest, OrderedLookups) {
+  s21::concurrent_set<int> s = {5, 1, 9, 3};
+  EXPECT_FALSE(s.insert(5));
+  EXPECT_TRUE(s.insert(7));
+  EXPECT_EQ(s.size(), 5U);
+  EXPECT_EQ(*s.lower_bound(4), 5);
+  EXPECT_EQ(s.lower_bound(10), s.end());
+  EXPECT_EQ(*s.find(9), 9);
+  EXPECT_EQ(s.find(4), s.end());
+  auto it = s.find(3);
+  EXPECT_EQ(s.erase(3), 1U);
+  EXPECT_EQ(s.erase(3), 0U);
+  // an iterator keeps its erased element alive and steps past it
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(*++it, 5);
+  std::vector<int> seen(s.begin(), s.end());
+  EXPECT_EQ(seen, (std::vector<int>{1, 5, 7, 9}));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(ConcurrentSetTest, InsertConvertsOnce) {
+  s21::LockFreeSkipList<std::string> list;
+  EXPECT_TRUE(list.Insert("str"));
+  EXPECT_FALSE(list.Insert("str"));
+  std::string other = "other";
+  EXPECT_TRUE(list.Insert(other));
+  EXPECT_EQ(other, "other");
+  EXPECT_TRUE(list.Contains(std::string("str")));
+  s21::concurrent_set<std::string> s;
+  EXPECT_TRUE(s.insert("str"));
+  EXPECT_FALSE(s.insert("str"));
+  EXPECT_EQ(s.size(), 1U);
+}
+
+TEST(ConcurrentSetTest, ParallelInsertErase) {
+  s21::concurrent_set<int> s;
+  std::atomic<int> bad(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&s, &bad, t] {
+      // keys t, t + 4, ... are this thread's own; 0 .. 99 are shared
+      for (int i = 0; i < 3000; i++) {
+        int key = 100 + t + 4 * i;
+        if (!s.insert(key) || !s.contains(key)) bad++;
+        if (i % 2 == 0 && s.erase(key) != 1) bad++;
+        s.insert(i % 100);
+        s.erase((i + 50) % 100);
+      }
+    });
+  }
+  std::thread reader([&s, &bad] {
+    for (int round = 0; round < 20; round++) {
+      int previous = -1;
+      for (int key : s) {
+        if (key <= previous) bad++;
+        previous = key;
+      }
+    }
+  });
+  for (auto& thread : threads) thread.join();
+  reader.join();
+  EXPECT_EQ(bad, 0);
+  size_t own = 0;
+  for (int key : s) own += key >= 100;
+  EXPECT_EQ(own, 6000U);
+}
+
+TEST(ConcurrentSkipMapTest, ImmutableEntries) {
+  s21::concurrent_skip_map<std::string, int> m = {{"b", 2}, {"a", 1}};
+  EXPECT_TRUE(m.insert("c", 3));
+  EXPECT_FALSE(m.insert({"a", 10}));
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  EXPECT_EQ(m.lower_bound("bb")->first, "c");
+  EXPECT_EQ(m.erase("b"), 1U);
+  std::string keys;
+  for (const auto& entry : m) keys += entry.first;
+  EXPECT_EQ(keys, "ac");
+  EXPECT_EQ(m.size(), 2U);
+}
+
+// Checks the B-tree shape and returns the number of elements below node.
+// Appends leave the rightmost nodes short, the others must be half full.
+template <typename Tree>
+size_t CheckBTreeNode(const Tree& tree, const typename Tree::Node* node,
+                      bool rightmost, int depth, int* leaf_depth) {
+  const auto& comp = tree.GetCompare();
+  const auto& key = tree.GetKeyOfValue();
+  if (!rightmost) {
+    EXPECT_GE(node->count, Tree::Node::kMinSlots);
+  }
+  EXPECT_LE(node->count, Tree::Node::kSlots);
+  for (int i = 1; i < node->count; i++) {
+    EXPECT_FALSE(comp(key(node->Slot(i)), key(node->Slot(i - 1))));
+  }
+  size_t total = node->count;
+  if (node->leaf) {
+    if (*leaf_depth < 0) *leaf_depth = depth;
+    EXPECT_EQ(depth, *leaf_depth);
+    return total;
+  }
+  for (int i = 0; i <= node->count; i++) {
+    const auto* child = node->Child(i);
+    EXPECT_EQ(child->parent, node);
+    EXPECT_EQ(child->position, i);
+    if (i > 0) {
+      EXPECT_FALSE(comp(key(child->Slot(0)), key(node->Slot(i - 1))));
+    }
+    if (i < node->count) {
+      EXPECT_FALSE(
+          comp(key(node->Slot(i)), key(child->Slot(child->count - 1))));
+    }
+    total += CheckBTreeNode(tree, child, rightmost && i == node->count,
+                            depth + 1, leaf_depth);
+  }
+  return total;
+}
+template <typename Tree>
+void CheckBTree(const Tree& tree) {
+  if (tree.GetRoot() == nullptr) {
+    EXPECT_EQ(tree.Size(), 0U);
+    return;
+  }
+  int leaf_depth = -1;
+  EXPECT_EQ(CheckBTreeNode(tree, tree.GetRoot(), true, 0, &leaf_depth),
+            tree.Size());
+}
+
+TEST(BTreeSetTest, MatchesStdSet) {
+  s21::btree_set<int> s;
+  std::set<int> expected;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 3000);
+    if (seed % 3 != 0) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    }
+  }
+  CheckBTree(s.get_tree());
+  ASSERT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(s.rbegin(), s.rend(), expected.rbegin()));
+  for (int key = -1; key < 3001; key += 7) {
+    auto it = expected.lower_bound(key);
+    auto found = s.lower_bound(key);
+    EXPECT_EQ(found == s.end(), it == expected.end());
+    if (it != expected.end()) {
+      EXPECT_EQ(*found, *it);
+    }
+    EXPECT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+  while (!s.empty()) s.erase(s.begin());
+  CheckBTree(s.get_tree());
+}
+TEST(BTreeSetTest, SortedBuildIsPacked) {
+  std::vector<long> keys;
+  for (long i = 0; i < 100000; i++) keys.push_back(i * 2);
+  s21::btree_set<long> s(keys.begin(), keys.end());
+  CheckBTree(s.get_tree());
+  EXPECT_EQ(s.size(), 100000U);
+  EXPECT_LE(s.get_tree().Height(), 4);
+  EXPECT_EQ(*s.find(4242), 4242);
+  EXPECT_EQ(s.find(4243), s.end());
+  EXPECT_EQ(*s.upper_bound(4242), 4244);
+  auto hint = s.find(4242);
+  EXPECT_EQ(*s.insert(hint, 4243), 4243);
+  s21::btree_set<long> copy(s);
+  s.clear();
+  CheckBTree(copy.get_tree());
+  EXPECT_EQ(copy.size(), 100001U);
+  s21::btree_set<std::string> words = {"pear", "apple", "fig"};
+  auto result = words.insert_many("kiwi", "fig");
+  EXPECT_TRUE(result[0]);
+  EXPECT_FALSE(result[1]);
+  EXPECT_EQ(*words.begin(), "apple");
+}
+TEST(BTreeMapTest, Access) {
+  s21::btree_map<std::string, int> m = {{"b", 2}, {"a", 1}};
+  m["c"] = 3;
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  EXPECT_FALSE(m.insert({"a", 10}).second);
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_EQ(m["a"], 10);
+  EXPECT_TRUE(m.try_emplace("d", 4).second);
+  EXPECT_EQ(m.erase("b"), 1U);
+  std::string keys;
+  for (const auto& entry : m) keys += entry.first;
+  EXPECT_EQ(keys, "acd");
+  s21::btree_map<std::string, int> other = {{"a", 0}, {"e", 5}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 4U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("a"), 0);
+  s21::btree_map<int, std::vector<int>> big;
+  for (int i = 0; i < 5000; i++) big[i % 1000].push_back(i);
+  CheckBTree(big.get_tree());
+  EXPECT_EQ(big.size(), 1000U);
+  EXPECT_EQ(big.at(999).size(), 5U);
+}
+TEST(BTreeMultisetTest, EqualKeys) {
+  s21::btree_multiset<int> ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 6000; i++) {
+    ms.insert(i % 37);
+    expected.insert(i % 37);
+  }
+  CheckBTree(ms.get_tree());
+  EXPECT_EQ(ms.count(5), expected.count(5));
+  auto range = ms.equal_range(5);
+  EXPECT_EQ(static_cast<size_t>(std::distance(range.first, range.second)),
+            expected.count(5));
+  EXPECT_EQ(ms.erase(5), expected.erase(5));
+  EXPECT_FALSE(ms.contains(5));
+  CheckBTree(ms.get_tree());
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(FlatSetTest, MatchesStdSet) {
+  s21::flat_set<int> s;
+  std::set<int> expected;
+  unsigned seed = 777;
+  for (int i = 0; i < 5000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    if (seed % 3 != 0) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(s.rbegin(), s.rend(), expected.rbegin()));
+  for (int key = -1; key < 1001; key++) {
+    auto it = expected.lower_bound(key);
+    EXPECT_EQ(s.lower_bound(key) == s.end(), it == expected.end());
+    if (it != expected.end()) {
+      EXPECT_EQ(*s.lower_bound(key), *it);
+    }
+    auto up = expected.upper_bound(key);
+    EXPECT_EQ(s.upper_bound(key) - s.begin(),
+              std::distance(expected.begin(), up));
+    EXPECT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+}
+TEST(FlatSetTest, BulkInsert) {
+  s21::flat_set<std::string> s = {"m", "c", "x", "c"};
+  EXPECT_EQ(s.size(), 3U);
+  auto result = s.insert_many("d", "a", "m", "d", "z");
+  bool expected[] = {true, true, false, false, true};
+  for (size_t i = 0; i < 5; i++) EXPECT_EQ(result.data()[i], expected[i]);
+  std::string all;
+  for (const auto& key : s) all += key;
+  EXPECT_EQ(all, "acdmxz");
+  s21::flat_set<std::string> other = {"b", "c"};
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.size(), 7U);
+  auto hint = s.find("m");
+  EXPECT_EQ(*s.insert(hint, "l"), "l");
+  s.erase(s.begin());
+  EXPECT_EQ(*s.begin(), "b");
+  s21::flat_set<std::string> copy;
+  copy = s;
+  s.clear();
+  EXPECT_EQ(copy.range("c", "m").end() - copy.range("c", "m").begin(), 3);
+}
+// Counts copies; moving is free and does not throw
+struct CopyCounted {
+  static int copies;
+  int key = 0;
+  CopyCounted() = default;
+  explicit CopyCounted(int k) : key(k) {}
+  CopyCounted(const CopyCounted& other) : key(other.key) { ++copies; }
+  CopyCounted(CopyCounted&&) noexcept = default;
+  CopyCounted& operator=(const CopyCounted& other) {
+    key = other.key;
+    ++copies;
+    return *this;
+  }
+  CopyCounted& operator=(CopyCounted&&) noexcept = default;
+  bool operator<(const CopyCounted& other) const { return key < other.key; }
+};
+int CopyCounted::copies = 0;
+TEST(FlatSetTest, BulkInsertMovesOldElements) {
+  s21::flat_set<CopyCounted> s;
+  s21::flat_map<int, CopyCounted> m;
+  for (int i = 0; i < 100; i++) {
+    s.insert(CopyCounted(2 * i));
+    m.insert({2 * i, CopyCounted(i)});
+  }
+  // the batch itself is copied in, the 100 elements already there are not
+  CopyCounted::copies = 0;
+  s.insert_many(CopyCounted(1), CopyCounted(99));
+  EXPECT_LE(CopyCounted::copies, 4);
+  CopyCounted::copies = 0;
+  m.insert_many(std::make_pair(1, CopyCounted(1)),
+                std::make_pair(99, CopyCounted(99)));
+  EXPECT_LE(CopyCounted::copies, 6);
+  EXPECT_EQ(s.size(), 102U);
+  EXPECT_EQ(s.find(CopyCounted(98))->key, 98);
+  EXPECT_EQ(m.at(198).key, 99);
+  EXPECT_EQ(m.at(99).key, 99);
+}
+TEST(FlatMapTest, Access) {
+  s21::flat_map<std::string, int> m = {{"b", 2}, {"a", 1}, {"b", 20}};
+  EXPECT_EQ(m.at("b"), 2);
+  m["c"] = 3;
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  EXPECT_FALSE(m.insert({"a", 10}).second);
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_TRUE(m.try_emplace("d", 4).second);
+  m.find("d")->second = 40;
+  EXPECT_EQ(m.values().data()[3], 40);
+  EXPECT_EQ(m.erase("b"), 1U);
+  std::string keys;
+  int sum = 0;
+  for (const auto& [key, value] : m) {
+    keys += key;
+    sum += value;
+  }
+  EXPECT_EQ(keys, "acd");
+  EXPECT_EQ(sum, 53);
+  EXPECT_EQ((*m.rbegin()).first, "d");
+  s21::flat_map<std::string, int> other = {{"a", 0}, {"e", 5}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 4U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("a"), 0);
+  auto result = m.insert_many(std::make_pair("f", 6), std::make_pair("a", 7));
+  EXPECT_TRUE(result.data()[0]);
+  EXPECT_FALSE(result.data()[1]);
+  EXPECT_EQ(m.at("a"), 10);
+  const auto& view = m;
+  EXPECT_EQ(view.lower_bound("bb")->first, "c");
+  EXPECT_EQ(view.range("b", "e").begin()->second, 3);
+}
+
+TEST(FlatMapTest, EraseReleasesTail) {
+  auto counter = std::make_shared<int>(0);
+  s21::flat_map<int, std::shared_ptr<int>> m = {{1, counter}, {2, counter}};
+  s21::flat_set<std::shared_ptr<int>> s = {counter};
+  EXPECT_EQ(counter.use_count(), 4);
+  EXPECT_EQ(m.erase(1), 1U);
+  EXPECT_EQ(counter.use_count(), 3);
+  EXPECT_EQ(m.at(2), counter);
+  EXPECT_EQ(m.erase(2), 1U);
+  EXPECT_EQ(counter.use_count(), 2);
+  s.erase(s.begin());
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(UnorderedSetTest, MatchesStdSet) {
+  s21::unordered_set<int> s;
+  std::set<int> expected;
+  unsigned seed = 4242;
+  for (int i = 0; i < 30000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 5000);
+    if (seed % 3 != 0) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  std::set<int> seen(s.begin(), s.end());
+  EXPECT_EQ(seen, expected);
+  for (int key = 0; key < 5000; key++) {
+    EXPECT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+  EXPECT_LE(s.load_factor(), s.max_load_factor());
+  // erase only invalidates the erased iterator
+  for (auto it = s.begin(); it != s.end();) {
+    auto next = it;
+    ++next;
+    if (*it % 2 == 0) s.erase(it);
+    it = next;
+  }
+  for (int key = 0; key < 5000; key++) {
+    EXPECT_EQ(s.contains(key), key % 2 == 1 && expected.count(key) == 1);
+  }
+}
+TEST(UnorderedSetTest, IncrementalGrowth) {
+  s21::unordered_set<long> s;
+  size_t migrating = 0;
+  for (long i = 0; i < 20000; i++) {
+    s.insert(i * 64);
+    migrating += s.get_table().Migrating();
+    // half moved or not, every element stays visible
+    if (s.get_table().Migrating() && i % 97 == 0) {
+      for (long j = 0; j <= i; j += 13) ASSERT_TRUE(s.contains(j * 64));
+      EXPECT_EQ(static_cast<size_t>(std::distance(s.begin(), s.end())),
+                s.size());
+    }
+  }
+  EXPECT_GT(migrating, 0U);
+  size_t capacity = s.capacity();
+  s.reserve(100000);
+  EXPECT_FALSE(s.get_table().Migrating());
+  EXPECT_GT(s.capacity(), capacity);
+  EXPECT_TRUE(s.contains(64 * 19999));
+  s21::unordered_set<long> copy(s);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(copy.size(), 20000U);
+  auto result = s.insert_many(1L, 2L, 1L);
+  EXPECT_TRUE(result.data()[0]);
+  EXPECT_FALSE(result.data()[2]);
+}
+TEST(UnorderedMapTest, Access) {
+  s21::unordered_map<std::string, int> m = {{"b", 2}, {"a", 1}};
+  m["c"] = 3;
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  EXPECT_FALSE(m.insert({"a", 10}).second);
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_EQ(m["a"], 10);
+  EXPECT_TRUE(m.try_emplace("d", 4).second);
+  EXPECT_EQ(m.erase("b"), 1U);
+  int sum = 0;
+  for (const auto& entry : m) sum += entry.second;
+  EXPECT_EQ(sum, 17);
+  s21::unordered_map<std::string, int> other = {{"a", 0}, {"e", 5}};
+  m.merge(other);
+  EXPECT_EQ(m.size(), 4U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("a"), 0);
+  s21::unordered_map<int, std::vector<int>> big;
+  for (int i = 0; i < 5000; i++) big[i % 1000].push_back(i);
+  EXPECT_EQ(big.size(), 1000U);
+  EXPECT_EQ(big.at(999).size(), 5U);
+}
+
+TEST(SmallSetTest, MatchesStdSet) {
+  s21::small_set<int, 8> s;
+  std::set<int> expected;
+  unsigned seed = 777;
+  for (int i = 0; i < 3000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 24);
+    switch ((seed >> 16) % 4) {
+      case 0:
+      case 1:
+        EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+        break;
+      case 2:
+        EXPECT_EQ(s.erase(key), expected.erase(key));
+        break;
+      default:
+        if (expected.size() > 12) {
+          s.clear();
+          expected.clear();
+          EXPECT_TRUE(s.is_inline());
+        }
+    }
+    ASSERT_EQ(s.size(), expected.size());
+    if (expected.size() > 8) {
+      EXPECT_FALSE(s.is_inline());
+    }
+    ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+    ASSERT_TRUE(std::equal(s.rbegin(), s.rend(), expected.rbegin()));
+    EXPECT_EQ(std::distance(s.begin(), s.lower_bound(key)),
+              std::distance(expected.begin(), expected.lower_bound(key)));
+    EXPECT_EQ(std::distance(s.begin(), s.upper_bound(key)),
+              std::distance(expected.begin(), expected.upper_bound(key)));
+    EXPECT_EQ(s.count(key), expected.count(key));
+  }
+}
+TEST(SmallSetTest, InlineElementsStayPut) {
+  s21::small_set<std::string, 4> s = {"m", "c"};
+  const std::string* m = &*s.find("m");
+  s.insert("a");
+  s.insert("z");
+  EXPECT_EQ(s.erase("c"), 1U);
+  EXPECT_TRUE(s.is_inline());
+  EXPECT_EQ(&*s.find("m"), m);
+  EXPECT_EQ(*s.begin(), "a");
+  EXPECT_EQ(*--s.end(), "z");
+  s.insert("q");
+  s.emplace(1, 'b');
+  EXPECT_FALSE(s.is_inline());
+  EXPECT_EQ(std::distance(s.begin(), s.end()), 5);
+  s21::small_set<std::string, 4> copy = s;
+  s21::small_set<std::string, 4> other = {"x"};
+  other.swap(copy);
+  EXPECT_TRUE(copy.is_inline());
+  EXPECT_EQ(*copy.begin(), "x");
+  EXPECT_FALSE(other.is_inline());
+  EXPECT_TRUE(other.contains("q"));
+  s21::small_set<std::string, 4> moved(std::move(other));
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(moved.size(), 5U);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 5U);
+  s.clear();
+  EXPECT_TRUE(s.is_inline());
+  EXPECT_TRUE(s.insert("k").second);
+  EXPECT_EQ(*s.begin(), "k");
+}
+// Copies throw once the budget runs out. The move is the copy and may
+// throw, so spilling copies the inline elements.
+struct FragileKey {
+  explicit FragileKey(int k) : key(k) {}
+  FragileKey(const FragileKey& other) : key(other.key) {
+    if (--budget < 0) throw std::runtime_error("copy");
+  }
+  bool operator<(const FragileKey& other) const { return key < other.key; }
+  int key;
+  static int budget;
+};
+int FragileKey::budget = 0;
+TEST(SmallSetTest, FailedSpillKeepsElements) {
+  s21::small_set<FragileKey, 2> s;
+  FragileKey::budget = 100;
+  s.insert(FragileKey(2));
+  s.insert(FragileKey(1));
+  FragileKey::budget = 1;
+  EXPECT_THROW(s.insert(FragileKey(3)), std::runtime_error);
+  EXPECT_TRUE(s.is_inline());
+  ASSERT_EQ(s.size(), 2U);
+  EXPECT_EQ(s.begin()->key, 1);
+  EXPECT_EQ((--s.end())->key, 2);
+  FragileKey::budget = 100;
+  EXPECT_TRUE(s.insert(FragileKey(3)).second);
+  EXPECT_FALSE(s.is_inline());
+  EXPECT_EQ((--s.end())->key, 3);
+}
+TEST(SmallMapTest, Access) {
+  s21::small_map<std::string, int, 4> m = {{"b", 2}, {"a", 1}, {"b", 20}};
+  EXPECT_EQ(m.at("b"), 2);
+  m["c"] = 3;
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  EXPECT_FALSE(m.insert({"a", 10}).second);
+  EXPECT_FALSE(m.insert_or_assign("a", 10).second);
+  EXPECT_TRUE(m.try_emplace("d", 4).second);
+  EXPECT_TRUE(m.is_inline());
+  m.find("d")->second = 40;
+  EXPECT_EQ(m.erase("b"), 1U);
+  EXPECT_TRUE(m.insert("e", 5).second);
+  EXPECT_TRUE(m.emplace("f", 6).second);
+  EXPECT_FALSE(m.is_inline());
+  std::string keys;
+  int sum = 0;
+  for (const auto& [key, value] : m) {
+    keys += key;
+    sum += value;
+  }
+  EXPECT_EQ(keys, "acdef");
+  EXPECT_EQ(sum, 64);
+  EXPECT_EQ((*m.rbegin()).first, "f");
+  EXPECT_EQ(m.lower_bound("bb")->first, "c");
+  EXPECT_EQ(m.equal_range("d").first->second, 40);
+}
+TEST(SmallMapTest, SpillReadsArgumentsFirst) {
+  s21::small_map<int, std::string, 2> m = {{1, "one"}, {2, "two"}};
+  // the mapped value is copied from an inline element while it spills
+  EXPECT_TRUE(m.try_emplace(3, m.at(1)).second);
+  EXPECT_FALSE(m.is_inline());
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_EQ(m.at(3), "one");
+  m.clear();
+  EXPECT_TRUE(m.is_inline());
+  m[7] = "seven";
+  EXPECT_EQ(m.begin()->second, "seven");
+}
+
+TEST(FrozenSetTest, MatchesStdSet) {
+  // every shape of the implicit tree, from empty to a few full levels
+  unsigned seed = 31337;
+  for (int n = 0; n < 70; n++) {
+    std::vector<int> items;
+    for (int i = 0; i < n; i++) {
+      seed = seed * 1103515245 + 12345;
+      items.push_back(static_cast<int>((seed >> 8) % 100) * 2);
+    }
+    std::set<int> expected(items.begin(), items.end());
+    s21::frozen_set<int> s(items.begin(), items.end());
+    s21::frozen_set<int> sorted(expected.begin(), expected.end());
+    ASSERT_EQ(s.size(), expected.size());
+    EXPECT_EQ(s.empty(), expected.empty());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expected.begin()));
+    EXPECT_TRUE(std::equal(s.rbegin(), s.rend(), expected.rbegin()));
+    EXPECT_TRUE(std::equal(sorted.begin(), sorted.end(), expected.begin()));
+    for (int key = -1; key < 202; key++) {
+      auto it = expected.lower_bound(key);
+      EXPECT_EQ(std::distance(s.begin(), s.lower_bound(key)),
+                std::distance(expected.begin(), it));
+      EXPECT_EQ(std::distance(s.begin(), s.upper_bound(key)),
+                std::distance(expected.begin(), expected.upper_bound(key)));
+      EXPECT_EQ(s.contains(key), expected.count(key) == 1);
+      EXPECT_EQ(s.find(key) == s.end(), expected.count(key) == 0);
+    }
+  }
+  s21::frozen_set<int> empty;
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(0));
+}
+TEST(FrozenSetTest, Layout) {
+  s21::frozen_set<int> s = {7, 3, 5, 1, 6, 2, 4, 4};
+  // BFS order of the complete tree over 1..7
+  std::vector<int> slots(s.slots().data() + 1, s.slots().data() + 8);
+  EXPECT_EQ(slots, std::vector<int>({4, 2, 6, 1, 3, 5, 7}));
+  int sum = 0;
+  for (int key : s.range(2, 6)) sum += key;
+  EXPECT_EQ(sum, 2 + 3 + 4 + 5);
+  auto [first, last] = s.equal_range(5);
+  EXPECT_EQ(*first, 5);
+  EXPECT_EQ(*--last, 5);
+  s21::frozen_set<std::string, std::greater<std::string>> words(
+      {"b", "a", "c"});
+  EXPECT_EQ(*words.begin(), "c");
+  EXPECT_EQ(*--words.end(), "a");
+  s21::frozen_set<std::string, std::greater<std::string>> copy;
+  copy = words;
+  EXPECT_TRUE(copy.contains("b"));
+  EXPECT_FALSE(copy.contains("d"));
+}
+TEST(FrozenMapTest, Access) {
+  s21::frozen_map<std::string, int> m = {
+      {"b", 2}, {"a", 1}, {"d", 4}, {"a", 10}, {"c", 3}};
+  EXPECT_EQ(m.size(), 4U);
+  // the first of equal keys is kept
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_EQ(m.at("d"), 4);
+  EXPECT_THROW(m.at("z"), std::invalid_argument);
+  std::string keys;
+  int sum = 0;
+  for (const auto& entry : m) {
+    keys += entry.first;
+    sum += entry.second;
+  }
+  EXPECT_EQ(keys, "abcd");
+  EXPECT_EQ(sum, 10);
+  EXPECT_EQ(m.find("c")->second, 3);
+  EXPECT_TRUE(m.find("e") == m.end());
+  EXPECT_EQ(m.lower_bound("bb")->first, "c");
+  EXPECT_EQ((--m.end())->first, "d");
+  EXPECT_EQ(m.count("b"), 1U);
+  std::vector<std::pair<int, int>> pairs;
+  for (int i = 0; i < 1000; i++) pairs.push_back({i * 7919 % 1000, i});
+  s21::frozen_map<int, int> big(pairs.begin(), pairs.end());
+  for (int i = 0; i < 1000; i++) EXPECT_EQ(big.at(i * 7919 % 1000), i);
+  int previous = -1;
+  for (const auto& entry : big) {
+    EXPECT_EQ(entry.first, previous + 1);
+    previous = entry.first;
+  }
+}
+
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
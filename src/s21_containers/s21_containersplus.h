@@ -2,5 +2,25 @@
 #define S21_CONTAINERSPLUS_H
 
 #include "./array/s21_array.h"
+#include "./setMap/btree/s21_btree_map.tpp"
+#include "./setMap/btree/s21_btree_multiset.tpp"
+#include "./setMap/btree/s21_btree_set.tpp"
+#include "./setMap/compact/s21_compact_map.tpp"
+#include "./setMap/compact/s21_compact_set.tpp"
+#include "./setMap/concurrent/s21_concurrent_map.tpp"
+#include "./setMap/concurrent/s21_concurrent_set.tpp"
+#include "./setMap/concurrent/s21_concurrent_skip_map.tpp"
+#include "./setMap/flat/s21_flat_map.tpp"
+#include "./setMap/flat/s21_flat_set.tpp"
+#include "./setMap/frozen/s21_frozen_map.tpp"
+#include "./setMap/frozen/s21_frozen_set.tpp"
+#include "./setMap/interval/s21_interval_map.tpp"
+#include "./setMap/multiset/s21_multiset.tpp"
+#include "./setMap/persistent/s21_persistent_map.tpp"
+#include "./setMap/persistent/s21_persistent_set.tpp"
+#include "./setMap/small/s21_small_map.tpp"
+#include "./setMap/small/s21_small_set.tpp"
+#include "./setMap/unordered/s21_unordered_map.tpp"
+#include "./setMap/unordered/s21_unordered_set.tpp"
 
 #endif  // S21_CONTAINERS_H
\ No newline at end of file
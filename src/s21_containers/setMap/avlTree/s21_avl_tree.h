@@ -1,18 +1,95 @@
 #ifndef SRC_AVL_H_
 #define SRC_AVL_H_
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_node_pool.h"
 using namespace std;
 
 namespace s21 {
+// Augmentation: tagging the mapped type as Augmented<V, Policy> makes every
+// node keep Policy's aggregate of its subtree, maintained wherever size_
+// is. Policy is a monoid over stored values: value_type, Identity(),
+// Lift(stored value) and an associative Combine(a, b). The tree holds a
+// Policy object, so Combine may use state such as a comparator.
+template <typename V, typename Policy>
+struct Augmented {};
+struct NoAggregate {};
+template <typename V>
+struct AugmentTraits {
+  static constexpr bool kEnabled = false;
+  using mapped_type = V;
+  using policy = NoAggregate;
+};
+template <typename V, typename Policy>
+struct AugmentTraits<Augmented<V, Policy>> {
+  static constexpr bool kEnabled = true;
+  using mapped_type = V;
+  using policy = Policy;
+};
+// Plain nodes carry nothing extra
+template <typename V>
+struct NodeAggregate {};
+template <typename V, typename Policy>
+struct NodeAggregate<Augmented<V, Policy>> {
+  typename Policy::value_type aggregate;
+};
+// Ready-made monoids; they lift the mapped value of a pair, else the value
+template <typename U>
+const U& AggregatedPart(const U& value) {
+  return value;
+}
+template <typename K, typename U>
+const U& AggregatedPart(const std::pair<K, U>& value) {
+  return value.second;
+}
+template <typename R>
+struct SumAggregate {
+  using value_type = R;
+  static R Identity() { return R(); }
+  template <typename U>
+  static R Lift(const U& value) {
+    return R(AggregatedPart(value));
+  }
+  static R Combine(const R& a, const R& b) { return a + b; }
+};
+template <typename R>
+struct MinAggregate {
+  using value_type = R;
+  static R Identity() { return std::numeric_limits<R>::max(); }
+  template <typename U>
+  static R Lift(const U& value) {
+    return R(AggregatedPart(value));
+  }
+  static R Combine(const R& a, const R& b) { return b < a ? b : a; }
+};
+template <typename R>
+struct MaxAggregate {
+  using value_type = R;
+  static R Identity() { return std::numeric_limits<R>::lowest(); }
+  template <typename U>
+  static R Lift(const U& value) {
+    return R(AggregatedPart(value));
+  }
+  static R Combine(const R& a, const R& b) { return a < b ? b : a; }
+};
 // AVL tree node
 template <typename T, typename V>
-class Node {
+class Node : public NodeAggregate<V> {
  public:
   mutable T key;
   int height;
   size_t size_;
-  bool isSentinel;
+  // The pool the node's storage comes from, whichever tree holds it now
+  NodePool<Node<T, V>>* pool;
   Node<T, V>* left;
   Node<T, V>* right;
   Node<T, V>* parent;
@@ -21,59 +98,298 @@ class Node {
       : key(k),
         height(1),
         size_(1),
-        isSentinel(false),
+        pool(nullptr),
         left(nullptr),
         right(nullptr),
         parent(nullptr) {}
 
-  Node(T& k)
-      : key(k),
+  Node(T&& k)
+      : key(std::move(k)),
+        height(1),
+        size_(1),
+        pool(nullptr),
+        left(nullptr),
+        right(nullptr),
+        parent(nullptr) {}
+
+  // Constructs the key in place from args
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args&&... args)
+      : key(std::forward<Args>(args)...),
         height(1),
         size_(1),
-        isSentinel(false),
+        pool(nullptr),
         left(nullptr),
         right(nullptr),
         parent(nullptr) {}
 };
+// KeyOfValue policies: extract the part of a stored value the tree orders by
+template <typename T>
+struct Identity {
+  const T& operator()(const T& value) const { return value; }
+};
+template <typename Pair>
+struct SelectFirst {
+  const typename Pair::first_type& operator()(const Pair& value) const {
+    return value.first;
+  }
+};
+// Root and both ends of a tree. It stands for end(): --end() reads
+// rightmost and jumps back from end() start at root. It belongs to the
+// tree object, not to the nodes, so iterators on a node never read it;
+// swap and merge may have moved the node to another tree.
+template <typename T, typename V>
+struct TreeHeader {
+  Node<T, V>* root = nullptr;
+  Node<T, V>* leftmost = nullptr;
+  Node<T, V>* rightmost = nullptr;
+};
+// Destroys node and gives its storage back to the pool it came from
 template <typename T, typename V>
+void FreeNode(Node<T, V>* node) {
+  NodePool<Node<T, V>>* pool = node->pool;
+  node->~Node<T, V>();
+  pool->Deallocate(node);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+class AVLTree;
+// Owns a node extracted from a tree, like C++17 node_type. The node keeps
+// its pool alive, so the handle may outlive the tree.
+template <typename T, typename V>
+class NodeHandle {
+ public:
+  using value_type = T;
+
+  NodeHandle() noexcept : node_(nullptr) {}
+  NodeHandle(NodeHandle&& other) noexcept
+      : node_(std::exchange(other.node_, nullptr)) {}
+  NodeHandle& operator=(NodeHandle&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      node_ = std::exchange(other.node_, nullptr);
+    }
+    return *this;
+  }
+  ~NodeHandle() { Reset(); }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+  T& value() const { return node_->key; }
+  // For map nodes
+  template <typename U = T>
+  const typename U::first_type& key() const {
+    return node_->key.first;
+  }
+  template <typename U = T>
+  typename U::second_type& mapped() const {
+    return node_->key.second;
+  }
+
+ private:
+  template <typename, typename, typename, typename>
+  friend class AVLTree;
+
+  Node<T, V>* node_;
+
+  void Reset() {
+    if (node_ != nullptr) {
+      FreeNode(node_);
+      node_ = nullptr;
+    }
+  }
+};
+// Compare is a strict weak ordering over KeyOfValue(T); every descent calls
+// it once per level and resolves equality with one extra call at the end.
+// Search, Remove and CountLess take a key, not a whole stored value.
+template <typename T, typename V, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
 class AVLTree {
  public:
+  using policy_type = typename AugmentTraits<V>::policy;
+
   AVLTree();
+  explicit AVLTree(const Compare& comp);
+  // Augmented trees whose policy carries state
+  AVLTree(const Compare& comp, const policy_type& policy);
   AVLTree(const AVLTree& other);
+  AVLTree(AVLTree&& other) noexcept;
   ~AVLTree();
-  AVLTree<T, V>& operator=(AVLTree&& other) noexcept;
-  Node<T, V>* Insert(T key);
-  Node<T, V>* Insert_multiset(T key);
-  void Remove(T key);
-  Node<T, V>* Search(T key);
+  AVLTree& operator=(AVLTree&& other) noexcept;
+  // Insert returns the new node, or the node already holding an equal key
+  Node<T, V>* Insert(const T& key);
+  Node<T, V>* Insert(T&& key);
+  // Hinted insert: when the key belongs right before or right after hint
+  // (nullptr meaning the end) it is linked there with at most four
+  // comparisons, otherwise this falls back to a descent from the root
+  Node<T, V>* Insert(Node<T, V>* hint, const T& key);
+  Node<T, V>* Insert(Node<T, V>* hint, T&& key);
+  // Build the value in place from args, the hint works as in Insert. The
+  // node is freed again when an equal key is already present.
+  template <typename... Args>
+  Node<T, V>* Emplace(Args&&... args);
+  template <typename... Args>
+  Node<T, V>* EmplaceHint(Node<T, V>* hint, Args&&... args);
+  // Like Emplace, but looks key up first and builds the value only when
+  // the key is absent
+  template <typename K, typename... Args>
+  Node<T, V>* TryEmplace(const K& key, Args&&... args);
+  // Multiset counterparts: always insert, after any equal keys
+  Node<T, V>* Insert_multiset(const T& key);
+  Node<T, V>* Insert_multiset(T&& key);
+  Node<T, V>* Insert_multiset(NodeHandle<T, V>&& handle);
+  template <typename... Args>
+  Node<T, V>* Emplace_multiset(Args&&... args);
+  // Relinks every node of other, no allocation or copy
+  void Merge_multiset(AVLTree& other);
+  // Fills an empty tree with values, which must already be sorted; equal
+  // keys keep their order. Nodes are linked balanced at once: O(n)
+  void Assign_multiset(std::vector<T>&& values);
+  // Inserts a batch at once. The batch is sorted (skipped when it already
+  // is) and merged with the in-order sequence of the tree, then all nodes
+  // are relinked into a perfectly balanced tree: O(n + m log m) instead of
+  // m descents. A batch much smaller than the tree is inserted one by one.
+  // Returns, in input order, the node holding each key and whether the
+  // value was inserted; later duplicates in the batch are not.
+  std::vector<std::pair<Node<T, V>*, bool>> InsertMany(std::vector<T>&& values);
+  template <typename K>
+  void Remove(const K& key);
+  // Removes every node with a key equal to key, returns how many
+  template <typename K>
+  size_t RemoveAll(const K& key);
+  void Remove(Node<T, V>* node);
+  // Unlinks node and hands it over without destroying the value
+  NodeHandle<T, V> Extract(Node<T, V>* node);
+  // Links the handle's node unless its key is present; the handle is
+  // emptied on success and keeps the node otherwise
+  Node<T, V>* Insert(NodeHandle<T, V>&& handle);
+  // Relinks every node of other whose key is not in this tree, with no
+  // allocation or copy; nodes with a key present here stay in other.
+  // other is walked in order, so each node costs an amortized O(1) hinted
+  // link here and O(log m) to unlink from other.
+  void Merge(AVLTree& other);
+  template <typename K>
+  Node<T, V>* Search(const K& key) const;
+  // Search starting at finger instead of the root: climbs to the lowest
+  // ancestor whose key range covers key, then descends. The cost is the
+  // height of that ancestor, O(log d) for keys d positions apart inside a
+  // common subtree and O(log n) at worst.
+  template <typename K>
+  Node<T, V>* FingerSearch(Node<T, V>* finger, const K& key) const;
+  // First node whose key is not less (LowerBound) or greater (UpperBound)
+  // than key, nullptr when there is none
+  template <typename K>
+  Node<T, V>* LowerBound(const K& key) const;
+  template <typename K>
+  Node<T, V>* UpperBound(const K& key) const;
   Node<T, V>* GetRoot() const;
+  // Leftmost and rightmost are kept up to date by every update, O(1)
+  const TreeHeader<T, V>* GetHeader() const;
   Node<T, V>* GetNil();
-  void SetRoot(Node<T, V>* root);
-  void Swap(AVLTree<T, V>& other);
+  void SetRoot(Node<T, V>* node);
+  void Swap(AVLTree& other);
   void Clear(Node<T, V>* node);
   bool GetInserted();
   Node<T, V>* MaximumKey(Node<T, V>* node);
+  const Compare& GetCompare() const;
+  // Order statistics, O(log n) through the subtree sizes kept in size_
+  template <typename K>
+  size_t CountLess(const K& key) const;
+  template <typename K>
+  size_t Count(const K& key) const;
+  Node<T, V>* Select(size_t k) const;
+  // Join-based set algebra, O(m log(n / m + 1)) for sizes m <= n. Each
+  // call consumes other: its nodes are linked into this tree or freed, and
+  // other is left empty. On equal keys the node of this tree is kept.
+  void Union(AVLTree& other);
+  void Intersection(AVLTree& other);
+  void Difference(AVLTree& other);
+  // Moves every key not less than key into other in O(log n)
+  template <typename K>
+  void Split(const K& key, AVLTree& other);
+  // Augmented trees only: Policy's aggregate of the values with keys in
+  // [lo, hi) in O(log n), folded in key order
+  template <typename K>
+  auto Aggregate(const K& lo, const K& hi) const;
+  auto Aggregate() const;
+  // Recomputes the aggregates above node after its value was changed in
+  // place, O(log n); does nothing for plain trees
+  void Refresh(Node<T, V>* node);
 
  private:
-  Node<T, V>* root;
+  TreeHeader<T, V> header_;
   Node<T, V>* nil;
   bool inserted;
-  int Size(Node<T, V>* node);
+  Compare comp_;
+  KeyOfValue key_of_;
+  policy_type policy_;
+  // pool_ is what this tree allocates from. Nodes taken over from other
+  // trees by merge, node handles, the set algebra or Split stay in their
+  // slabs and are freed back to their own pools.
+  NodePool<Node<T, V>>* pool_ = nullptr;
+  // Set once nodes from another tree may have been linked in; Clear must
+  // then free node by node
+  bool foreign_ = false;
+  size_t Size(Node<T, V>* node) const;
   int Height(Node<T, V>* node);
   void UpdateSize(Node<T, V>* node);
   int BalanceFactor(Node<T, V>* node);
   void UpdateHeight(Node<T, V>* node);
   Node<T, V>* Balance(Node<T, V>* node);
+  void Rebalance(Node<T, V>* node);
+  static constexpr bool kAugmented = AugmentTraits<V>::kEnabled;
+  void Retrace(Node<T, V>* node, bool grown);
+  void ResetNode(Node<T, V>* node);
+  void UpdateAggregate(Node<T, V>* node);
+  void ReplaceChild(Node<T, V>* parent, Node<T, V>* old_child,
+                    Node<T, V>* new_child);
   Node<T, V>* FindMin(Node<T, V>* node);
+  void ResetBounds();
+  Node<T, V>* Successor(Node<T, V>* node) const;
+  Node<T, V>* Predecessor(Node<T, V>* node) const;
+  template <typename K>
+  Node<T, V>* SearchFrom(Node<T, V>* node, const K& key) const;
+  Node<T, V>* BuildBalanced(const std::vector<Node<T, V>*>& nodes, size_t lo,
+                            size_t hi, Node<T, V>* parent);
+  void MergeSorted(std::vector<T>& values, const std::vector<size_t>& order,
+                   std::vector<std::pair<Node<T, V>*, bool>>& result);
   Node<T, V>* CopyTree(Node<T, V>* node);
+  template <typename... Args>
+  Node<T, V>* NewNode(Args&&... args);
+  void DeleteNode(Node<T, V>* node);
+  void DestroySubtree(Node<T, V>* node);
+  void DeleteSubtree(Node<T, V>* node);
+  NodePool<Node<T, V>>& Pool();
+  Node<T, V>* TakeAll(AVLTree& other);
+  void Unlink(Node<T, V>* node);
+  Node<T, V>* Join(Node<T, V>* left, Node<T, V>* node, Node<T, V>* right);
+  Node<T, V>* JoinTwo(Node<T, V>* left, Node<T, V>* right);
+  Node<T, V>* SplitLast(Node<T, V>* node, Node<T, V>*& rest);
+  template <typename K>
+  void SplitBy(Node<T, V>* node, const K& key, bool inclusive,
+               Node<T, V>*& left, Node<T, V>*& right);
+  template <typename K>
+  Node<T, V>* SplitNode(Node<T, V>* node, const K& key, Node<T, V>*& left,
+                        Node<T, V>*& right);
+  Node<T, V>* UnionNodes(Node<T, V>* a, Node<T, V>* b);
+  Node<T, V>* IntersectNodes(Node<T, V>* a, Node<T, V>* b);
+  Node<T, V>* DifferenceNodes(Node<T, V>* a, Node<T, V>* b);
   Node<T, V>* RotateLeft(Node<T, V>* node);
   Node<T, V>* RotateRight(Node<T, V>* node);
-  Node<T, V>* RemoveMin(Node<T, V>* node);
-  Node<T, V>* Remove(Node<T, V>* node, T key);
-  Node<T, V>* Search(Node<T, V>* node, T key);
-  Node<T, V>* Insert(Node<T, V>* node, T key, Node<T, V>* parent);
-  Node<T, V>* Insert_multiset(Node<T, V>* node, T key, Node<T, V>* parent);
+  Node<T, V>* Link(Node<T, V>* node, Node<T, V>* parent, bool to_left);
+  template <typename K, typename Make>
+  Node<T, V>* InsertKey(const K& key, Make make);
+  template <typename K, typename Make>
+  Node<T, V>* InsertKeyHint(Node<T, V>* hint, const K& key, Make make);
+  Node<T, V>* PlaceNode(Node<T, V>* node, Node<T, V>* hint, bool hinted);
+  template <typename U>
+  Node<T, V>* InsertUnique(U&& value);
+  template <typename K, typename Make>
+  Node<T, V>* InsertEqualKey(const K& key, Make make);
+  template <typename U>
+  Node<T, V>* InsertEqual(U&& value);
+  template <typename U>
+  Node<T, V>* InsertHint(Node<T, V>* hint, U&& value);
 };
 }  // namespace s21
 
-#endif  // SRC_AVL_H_
\ No newline at end of file
+#endif  // SRC_AVL_H_
@@ -1,36 +1,96 @@
 #include "s21_avl_tree.h"
 namespace s21 {
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree() : root(nullptr), nil(nullptr), inserted(false) {}
-template <typename T, typename V>
-AVLTree<T, V>::AVLTree(const AVLTree& other)
-    : root(CopyTree(other.GetRoot())) {}
-template <typename T, typename V>
-AVLTree<T, V>& AVLTree<T, V>::operator=(AVLTree&& other) noexcept {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::AVLTree()
+    : header_(),
+      nil(nullptr),
+      inserted(false),
+      comp_(),
+      key_of_(),
+      policy_() {}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::AVLTree(const Compare& comp)
+    : header_(),
+      nil(nullptr),
+      inserted(false),
+      comp_(comp),
+      key_of_(),
+      policy_() {}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::AVLTree(const Compare& comp,
+                                            const policy_type& policy)
+    : header_(),
+      nil(nullptr),
+      inserted(false),
+      comp_(comp),
+      key_of_(),
+      policy_(policy) {}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::AVLTree(const AVLTree& other)
+    : header_(),
+      nil(nullptr),
+      inserted(false),
+      comp_(other.comp_),
+      key_of_(),
+      policy_(other.policy_) {
+  header_.root = CopyTree(other.GetRoot());
+  ResetBounds();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::AVLTree(AVLTree&& other) noexcept
+    : header_(exchange(other.header_, TreeHeader<T, V>())),
+      nil(nullptr),
+      inserted(false),
+      comp_(other.comp_),
+      key_of_(),
+      policy_(other.policy_),
+      pool_(exchange(other.pool_, nullptr)),
+      foreign_(exchange(other.foreign_, false)) {}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>&
+AVLTree<T, V, Compare, KeyOfValue>::operator=(AVLTree&& other) noexcept {
   if (this != &other) {
-    Clear(root);
-    root = exchange(other.root, nullptr);
+    Clear(header_.root);
+    header_ = exchange(other.header_, TreeHeader<T, V>());
+    comp_ = other.comp_;
+    policy_ = other.policy_;
+    if (pool_ != nullptr) pool_->Disown();
+    pool_ = exchange(other.pool_, nullptr);
+    foreign_ = exchange(other.foreign_, false);
   }
   return *this;
 }
-template <typename T, typename V>
-int AVLTree<T, V>::Height(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+int AVLTree<T, V, Compare, KeyOfValue>::Height(Node<T, V>* node) {
   if (!node) return 0;
   return node->height;
 }
-template <typename T, typename V>
-int AVLTree<T, V>::BalanceFactor(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+int AVLTree<T, V, Compare, KeyOfValue>::BalanceFactor(Node<T, V>* node) {
   if (!node) return 0;
   return (Height(node->left) - Height(node->right));
 }
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateHeight(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::UpdateHeight(Node<T, V>* node) {
   int hl = Height(node->left);
   int hr = Height(node->right);
   node->height = (hl > hr ? hl : hr) + 1;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::ReplaceChild(Node<T, V>* parent,
+                                                      Node<T, V>* old_child,
+                                          Node<T, V>* new_child) {
+  if (parent == nullptr) {
+    // subtrees detached by the set algebra have no parent either
+    if (header_.root == old_child) header_.root = new_child;
+  } else if (parent->left == old_child) {
+    parent->left = new_child;
+  } else {
+    parent->right = new_child;
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::RotateRight(Node<T, V>* node) {
   Node<T, V>* newRoot = node->left;
   node->left = newRoot->right;
   if (newRoot->right) {
@@ -38,13 +98,16 @@ Node<T, V>* AVLTree<T, V>::RotateRight(Node<T, V>* node) {
   }
   newRoot->right = node;
   newRoot->parent = node->parent;
+  ReplaceChild(node->parent, node, newRoot);
   node->parent = newRoot;
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateSize(node);
+  UpdateHeight(newRoot);
+  UpdateSize(newRoot);
   return newRoot;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::RotateLeft(Node<T, V>* node) {
   Node<T, V>* newRoot = node->right;
   node->right = newRoot->left;
   if (newRoot->left) {
@@ -52,201 +115,793 @@ Node<T, V>* AVLTree<T, V>::RotateLeft(Node<T, V>* node) {
   }
   newRoot->left = node;
   newRoot->parent = node->parent;
+  ReplaceChild(node->parent, node, newRoot);
   node->parent = newRoot;
-  UpdateHeight(newRoot);
   UpdateHeight(node);
+  UpdateSize(node);
+  UpdateHeight(newRoot);
+  UpdateSize(newRoot);
   return newRoot;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Balance(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Balance(Node<T, V>* node) {
   UpdateHeight(node);
+  UpdateSize(node);
   if (BalanceFactor(node) == 2) {
-    if (BalanceFactor(node->right) < -1) {
-      node->left = RotateLeft(node->left);
-      UpdateSize(node->left);
+    if (BalanceFactor(node->left) < 0) {
+      RotateLeft(node->left);
     }
     node = RotateRight(node);
-    UpdateSize(node);
-  }
-  if (BalanceFactor(node) == -2) {
-    if (BalanceFactor(node->left) > 1) {
-      node->right = RotateRight(node->right);
-      UpdateSize(node->right);
+  } else if (BalanceFactor(node) == -2) {
+    if (BalanceFactor(node->right) > 0) {
+      RotateRight(node->right);
     }
     node = RotateLeft(node);
-    UpdateSize(node);
   }
-  UpdateSize(node);
   return node;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(Node<T, V>* node, T key, Node<T, V>* parent) {
-  this->inserted = false;
-  if (!node) {
-    node = new Node<T, V>(key);
-    node->parent = parent;
-    this->inserted = true;
-    return Balance(node);
-  }
-  if (key < node->key) {
-    node->left = Insert(node->left, key, node);
-  } else if (key > node->key) {
-    node->right = Insert(node->right, key, node);
+// Walks from node up to the root restoring heights, sizes and balance
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Rebalance(Node<T, V>* node) {
+  while (node != nullptr) {
+    node = Balance(node)->parent;
+  }
+}
+// Rebalancing after a single insertion (grown) or removal. Once a subtree
+// keeps its height nothing above it can rotate, so the rest of the way up
+// only the subtree sizes change.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Retrace(Node<T, V>* node,
+                                                 bool grown) {
+  while (node != nullptr) {
+    int height = node->height;
+    node = Balance(node);
+    if (node->height == height) {
+      for (node = node->parent; node != nullptr; node = node->parent) {
+        if constexpr (kAugmented) {
+          UpdateSize(node);
+        } else {
+          node->size_ = grown ? node->size_ + 1 : node->size_ - 1;
+        }
+      }
+      return;
+    }
+    node = node->parent;
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Link(Node<T, V>* node,
+                                                     Node<T, V>* parent,
+                                                     bool to_left) {
+  if constexpr (kAugmented) {
+    UpdateAggregate(node);
+  }
+  node->parent = parent;
+  if (parent == nullptr) {
+    header_.root = header_.leftmost = header_.rightmost = node;
+  } else if (to_left) {
+    parent->left = node;
+    if (parent == header_.leftmost) header_.leftmost = node;
   } else {
+    parent->right = node;
+    if (parent == header_.rightmost) header_.rightmost = node;
+  }
+  Retrace(parent, true);
+  this->inserted = true;
+  return node;
+}
+// Descends once by key and calls make() for the new node only when the
+// key is absent, so the value is built straight inside its node
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K, typename Make>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertKey(const K& key,
+                                                          Make make) {
+  Node<T, V>* parent = nullptr;
+  Node<T, V>* node = header_.root;
+  Node<T, V>* candidate = nullptr;
+  bool to_left = false;
+  while (node != nullptr) {
+    parent = node;
+    to_left = comp_(key, key_of_(node->key));
+    if (to_left) {
+      node = node->left;
+    } else {
+      candidate = node;
+      node = node->right;
+    }
+  }
+  if (candidate != nullptr && !comp_(key_of_(candidate->key), key)) {
     this->inserted = false;
+    return candidate;
   }
-  return Balance(node);
-}
-
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert_multiset(Node<T, V>* node, T key,
-                                           Node<T, V>* parent) {
-  this->inserted = false;
-  if (!node) {
-    node = new Node<T, V>(key);
-    node->parent = parent;
-    this->inserted = true;
-    return Balance(node);
-  }
-  if (key <= node->key) {
-    node->left = Insert_multiset(node->left, key, node);
-  } else if (key > node->key) {
-    node->right = Insert_multiset(node->right, key, node);
-  } else {
+  return Link(make(), parent, to_left);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename U>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertUnique(U&& value) {
+  return InsertKey(key_of_(value),
+                   [&] { return NewNode(std::forward<U>(value)); });
+}
+// Equal keys go after the ones already present. A key not less than the
+// maximum is appended without a descent, which keeps ascending input such
+// as timestamps at O(1) amortized per insert.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K, typename Make>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertEqualKey(const K& key,
+                                                               Make make) {
+  Node<T, V>* last = header_.rightmost;
+  if (last != nullptr && !comp_(key, key_of_(last->key))) {
+    return Link(make(), last, false);
+  }
+  Node<T, V>* parent = nullptr;
+  Node<T, V>* node = header_.root;
+  bool to_left = false;
+  while (node != nullptr) {
+    parent = node;
+    to_left = comp_(key, key_of_(node->key));
+    node = to_left ? node->left : node->right;
+  }
+  return Link(make(), parent, to_left);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename U>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertEqual(U&& value) {
+  return InsertEqualKey(key_of_(value),
+                        [&] { return NewNode(std::forward<U>(value)); });
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::FindMin(Node<T, V>* node) {
+  while (node->left) node = node->left;
+  return node;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Successor(
+    Node<T, V>* node) const {
+  if (node->right) {
+    node = node->right;
+    while (node->left) node = node->left;
+    return node;
+  }
+  while (node->parent && node->parent->right == node) node = node->parent;
+  return node->parent;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Predecessor(
+    Node<T, V>* node) const {
+  if (node->left) {
+    node = node->left;
+    while (node->right) node = node->right;
+    return node;
+  }
+  while (node->parent && node->parent->left == node) node = node->parent;
+  return node->parent;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K, typename Make>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertKeyHint(
+    Node<T, V>* hint, const K& key, Make make) {
+  if (header_.root == nullptr) {
+    return InsertKey(key, make);
+  }
+  if (hint == nullptr || comp_(key, key_of_(hint->key))) {
+    Node<T, V>* prev = hint ? Predecessor(hint) : header_.rightmost;
+    if (prev == nullptr || comp_(key_of_(prev->key), key)) {
+      // prev < key < hint: one of the two has a free slot next to key
+      if (hint != nullptr && hint->left == nullptr) {
+        return Link(make(), hint, true);
+      }
+      return Link(make(), prev, false);
+    }
+    if (!comp_(key, key_of_(prev->key))) {
+      this->inserted = false;
+      return prev;
+    }
+  } else if (!comp_(key_of_(hint->key), key)) {
     this->inserted = false;
+    return hint;
+  } else {
+    // hint < key, also accept the slot right after hint
+    Node<T, V>* next = Successor(hint);
+    if (next == nullptr || comp_(key, key_of_(next->key))) {
+      if (hint->right == nullptr) {
+        return Link(make(), hint, false);
+      }
+      return Link(make(), next, true);
+    }
+  }
+  return InsertKey(key, make);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename U>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::InsertHint(Node<T, V>* hint,
+                                                           U&& value) {
+  return InsertKeyHint(hint, key_of_(value),
+                       [&] { return NewNode(std::forward<U>(value)); });
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Emplace(Args&&... args) {
+  return PlaceNode(NewNode(std::in_place, std::forward<Args>(args)...),
+                   nullptr, false);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::EmplaceHint(Node<T, V>* hint,
+                                                            Args&&... args) {
+  return PlaceNode(NewNode(std::in_place, std::forward<Args>(args)...), hint,
+                   true);
+}
+// The value has to exist before its key can be compared, so emplace
+// builds the node first and frees it again when the key is taken
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::PlaceNode(Node<T, V>* node,
+                                                          Node<T, V>* hint,
+                                                          bool hinted) {
+  Node<T, V>* found = nullptr;
+  try {
+    auto make = [node] { return node; };
+    found = hinted ? InsertKeyHint(hint, key_of_(node->key), make)
+                   : InsertKey(key_of_(node->key), make);
+  } catch (...) {
+    DeleteNode(node);
+    throw;
+  }
+  if (found != node) {
+    DeleteNode(node);
   }
-  return Balance(node);
-}
-
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::FindMin(Node<T, V>* node) {
-  if (!node->left) return node;
-  return FindMin(node->left);
-}
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::RemoveMin(Node<T, V>* node) {
-  if (!node->left) return node->right;
-  node->left = RemoveMin(node->left);
-  return Balance(node);
-}
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Remove(Node<T, V>* node, T key) {
-  if (!node) return nullptr;
-  if (key < node->key) {
-    node->left = Remove(node->left, key);
-  } else if (key > node->key) {
-    node->right = Remove(node->right, key);
+  return found;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K, typename... Args>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::TryEmplace(const K& key,
+                                                           Args&&... args) {
+  return InsertKey(key, [&] {
+    return NewNode(std::in_place, std::forward<Args>(args)...);
+  });
+}
+// Plain descent limited to the subtree of node
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::SearchFrom(
+    Node<T, V>* node, const K& key) const {
+  Node<T, V>* candidate = nullptr;
+  while (node != nullptr) {
+    if (comp_(key_of_(node->key), key)) {
+      node = node->right;
+    } else {
+      candidate = node;
+      node = node->left;
+    }
+  }
+  if (candidate != nullptr && !comp_(key, key_of_(candidate->key))) {
+    return candidate;
+  }
+  return nullptr;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::FingerSearch(
+    Node<T, V>* finger, const K& key) const {
+  if (finger == nullptr) {
+    return Search(key);
+  }
+  Node<T, V>* node = finger;
+  if (comp_(key_of_(node->key), key)) {
+    // key lies to the right: climbing out of a left child bounds the range
+    while (node->parent != nullptr) {
+      Node<T, V>* parent = node->parent;
+      if (parent->left == node) {
+        if (comp_(key, key_of_(parent->key))) break;
+        if (!comp_(key_of_(parent->key), key)) return parent;
+      }
+      node = parent;
+    }
+  } else if (comp_(key, key_of_(node->key))) {
+    while (node->parent != nullptr) {
+      Node<T, V>* parent = node->parent;
+      if (parent->right == node) {
+        if (comp_(key_of_(parent->key), key)) break;
+        if (!comp_(key, key_of_(parent->key))) return parent;
+      }
+      node = parent;
+    }
   } else {
-    Node<T, V>* left = node->left;
-    Node<T, V>* right = node->right;
-    Node<T, V>* parent = node->parent;
-    delete node;
-    if (!right) return left;
-    if (!left) return right;
-    Node<T, V>* min = FindMin(right);
-    min->right = RemoveMin(right);
-    min->left = left;
-    min->size_--;
-    min->parent = parent;
-    UpdateHeight(min);
-    return Balance(min);
+    return node;
   }
-  node->size_--;
+  return SearchFrom(node, key);
+}
+// Links nodes[lo, hi) into a perfectly balanced subtree under parent
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::BuildBalanced(
+    const std::vector<Node<T, V>*>& nodes, size_t lo, size_t hi,
+    Node<T, V>* parent) {
+  if (lo == hi) {
+    return nullptr;
+  }
+  size_t mid = lo + (hi - lo) / 2;
+  Node<T, V>* node = nodes[mid];
+  node->parent = parent;
+  node->left = BuildBalanced(nodes, lo, mid, node);
+  node->right = BuildBalanced(nodes, mid + 1, hi, node);
   UpdateHeight(node);
-  return Balance(node);
+  UpdateSize(node);
+  return node;
 }
-template <typename T, typename V>
-AVLTree<T, V>::~AVLTree() {
-  Clear(root);
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+std::vector<std::pair<Node<T, V>*, bool>>
+AVLTree<T, V, Compare, KeyOfValue>::InsertMany(std::vector<T>&& values) {
+  std::vector<std::pair<Node<T, V>*, bool>> result(values.size());
+  size_t n = Size(header_.root);
+  size_t depth = 1;
+  while ((size_t(1) << depth) <= n) depth++;
+  if (values.size() * depth < n) {
+    for (size_t i = 0; i < values.size(); i++) {
+      result[i].first = InsertUnique(std::move(values[i]));
+      result[i].second = inserted;
+    }
+    return result;
+  }
+  std::vector<size_t> order(values.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto less = [this, &values](size_t a, size_t b) {
+    return comp_(key_of_(values[a]), key_of_(values[b]));
+  };
+  bool sorted = true;
+  for (size_t i = 1; sorted && i < values.size(); i++) {
+    sorted = !less(i, i - 1);
+  }
+  if (!sorted) {
+    std::stable_sort(order.begin(), order.end(), less);
+  }
+  MergeSorted(values, order, result);
+  return result;
 }
-template <typename T, typename V>
-void AVLTree<T, V>::Clear(Node<T, V>* node) {
-  if (node != nullptr) {
-    Clear(node->left);
-    Clear(node->right);
-    delete node;
+// Merges the batch, visited through order, with the tree's nodes. New keys
+// get fresh nodes, existing nodes are reused as they are, so iterators to
+// elements already in the tree stay valid.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::MergeSorted(
+    std::vector<T>& values, const std::vector<size_t>& order,
+    std::vector<std::pair<Node<T, V>*, bool>>& result) {
+  std::vector<Node<T, V>*> nodes;
+  nodes.reserve(Size(header_.root) + values.size());
+  std::vector<Node<T, V>*> fresh;
+  fresh.reserve(values.size());
+  Node<T, V>* old = header_.root ? FindMin(header_.root) : nullptr;
+  try {
+    for (size_t i : order) {
+      const auto& key = key_of_(values[i]);
+      while (old != nullptr && comp_(key_of_(old->key), key)) {
+        nodes.push_back(old);
+        old = Successor(old);
+      }
+      if (old != nullptr && !comp_(key, key_of_(old->key))) {
+        result[i] = {old, false};
+      } else if (!fresh.empty() && nodes.back() == fresh.back() &&
+                 !comp_(key_of_(fresh.back()->key), key)) {
+        result[i] = {fresh.back(), false};
+      } else {
+        fresh.push_back(NewNode(std::move(values[i])));
+        nodes.push_back(fresh.back());
+        result[i] = {fresh.back(), true};
+      }
+    }
+  } catch (...) {
+    for (Node<T, V>* node : fresh) DeleteNode(node);
+    throw;
+  }
+  for (; old != nullptr; old = Successor(old)) nodes.push_back(old);
+  header_.root = BuildBalanced(nodes, 0, nodes.size(), nullptr);
+  if (!nodes.empty()) {
+    header_.leftmost = nodes.front();
+    header_.rightmost = nodes.back();
+  }
+  inserted = !fresh.empty();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Assign_multiset(
+    std::vector<T>&& values) {
+  std::vector<Node<T, V>*> nodes;
+  nodes.reserve(values.size());
+  try {
+    for (auto& value : values) nodes.push_back(NewNode(std::move(value)));
+  } catch (...) {
+    for (Node<T, V>* node : nodes) DeleteNode(node);
+    throw;
+  }
+  header_.root = BuildBalanced(nodes, 0, nodes.size(), nullptr);
+  if (!nodes.empty()) {
+    header_.leftmost = nodes.front();
+    header_.rightmost = nodes.back();
   }
-  root = nullptr;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(Node<T, V>* node, T key) {
-  if (!node || node->key == key) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Remove(Node<T, V>* node) {
+  Unlink(node);
+  DeleteNode(node);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Unlink(Node<T, V>* node) {
+  if (node == header_.leftmost) header_.leftmost = Successor(node);
+  if (node == header_.rightmost) header_.rightmost = Predecessor(node);
+  Node<T, V>* parent = node->parent;
+  Node<T, V>* fix = parent;
+  if (node->left && node->right) {
+    // the in-order successor takes the place of node, keys are not copied
+    Node<T, V>* min = FindMin(node->right);
+    if (min->parent != node) {
+      fix = min->parent;
+      fix->left = min->right;
+      if (min->right) min->right->parent = fix;
+      min->right = node->right;
+      node->right->parent = min;
+    } else {
+      fix = min;
+    }
+    min->left = node->left;
+    node->left->parent = min;
+    min->parent = parent;
+    min->height = node->height;
+    min->size_ = node->size_;
+    ReplaceChild(parent, node, min);
+  } else {
+    Node<T, V>* child = node->left ? node->left : node->right;
+    if (child) child->parent = parent;
+    ReplaceChild(parent, node, child);
+  }
+  Retrace(fix, false);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+NodeHandle<T, V> AVLTree<T, V, Compare, KeyOfValue>::Extract(
+    Node<T, V>* node) {
+  NodeHandle<T, V> handle;
+  if (node == nullptr) return handle;
+  Unlink(node);
+  handle.node_ = node;
+  return handle;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert(
+    NodeHandle<T, V>&& handle) {
+  if (handle.empty()) {
+    this->inserted = false;
+    return nullptr;
+  }
+  Node<T, V>* node = handle.node_;
+  Node<T, V>* found = InsertKey(key_of_(node->key), [this, node] {
+    ResetNode(node);
     return node;
+  });
+  if (found == node) {
+    foreign_ |= node->pool != pool_;
+    handle.node_ = nullptr;
   }
-  if (key < node->key) {
-    return Search(node->left, key);
+  return found;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Merge(AVLTree& other) {
+  if (this == &other || other.header_.root == nullptr) return;
+  // ascending keys: the successor of the last placed node is the hint
+  Node<T, V>* hint = nullptr;
+  Node<T, V>* node = other.header_.leftmost;
+  while (node != nullptr) {
+    Node<T, V>* next = other.Successor(node);
+    Node<T, V>* found = InsertKeyHint(hint, key_of_(node->key), [&] {
+      other.Unlink(node);
+      ResetNode(node);
+      foreign_ |= node->pool != pool_;
+      return node;
+    });
+    hint = Successor(found);
+    node = next;
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+AVLTree<T, V, Compare, KeyOfValue>::~AVLTree() {
+  Clear(header_.root);
+  if (pool_ != nullptr) pool_->Disown();
+}
+// Clears the whole tree. When the tree holds every node its pool handed
+// out and nothing else, keys are destroyed node by node only when that
+// does something and the storage goes back slab by slab. Otherwise each
+// node is freed to its own pool, and a pool that still has nodes in other
+// trees or handles is let go of, to be deleted with its last node.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Clear(Node<T, V>* node) {
+  if (!foreign_ && pool_ != nullptr && pool_->Live() == Size(node)) {
+    if (!std::is_trivially_destructible<Node<T, V>>::value) {
+      DestroySubtree(node);
+    }
+    pool_->Release();
   } else {
-    return Search(node->right, key);
+    DeleteSubtree(node);
+    if (pool_ != nullptr && pool_->Live() != 0) {
+      pool_->Disown();
+      pool_ = nullptr;
+    }
+  }
+  foreign_ = false;
+  header_ = TreeHeader<T, V>();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::DestroySubtree(Node<T, V>* node) {
+  if (node != nullptr) {
+    DestroySubtree(node->left);
+    DestroySubtree(node->right);
+    node->~Node<T, V>();
   }
 }
-template <typename T, typename V>
-void AVLTree<T, V>::SetRoot(Node<T, V>* root) {
-  this->root = root;
-  if (this->root != nullptr) {
-    this->root->parent = nullptr;
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::DeleteSubtree(Node<T, V>* node) {
+  if (node != nullptr) {
+    DeleteSubtree(node->left);
+    DeleteSubtree(node->right);
+    DeleteNode(node);
   }
 }
-template <typename T, typename V>
-void AVLTree<T, V>::UpdateSize(Node<T, V>* node) {
-  if (node) {
-    node->size_ = 1 + Size(node->left) + Size(node->right);
-    UpdateSize(node->left);
-    UpdateSize(node->right);
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+NodePool<Node<T, V>>& AVLTree<T, V, Compare, KeyOfValue>::Pool() {
+  if (pool_ == nullptr) {
+    pool_ = new NodePool<Node<T, V>>();
   }
+  return *pool_;
 }
-template <typename T, typename V>
-int AVLTree<T, V>::Size(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::NewNode(Args&&... args) {
+  void* place = Pool().Allocate();
+  Node<T, V>* node;
+  try {
+    node = new (place) Node<T, V>(std::forward<Args>(args)...);
+  } catch (...) {
+    pool_->Deallocate(place);
+    throw;
+  }
+  node->pool = pool_;
+  return node;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::DeleteNode(Node<T, V>* node) {
+  FreeNode(node);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Search(const K& key) const {
+  return SearchFrom(header_.root, key);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::LowerBound(
+    const K& key) const {
+  Node<T, V>* node = header_.root;
+  Node<T, V>* candidate = nullptr;
+  while (node != nullptr) {
+    if (comp_(key_of_(node->key), key)) {
+      node = node->right;
+    } else {
+      candidate = node;
+      node = node->left;
+    }
+  }
+  return candidate;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::UpperBound(
+    const K& key) const {
+  Node<T, V>* node = header_.root;
+  Node<T, V>* candidate = nullptr;
+  while (node != nullptr) {
+    if (comp_(key, key_of_(node->key))) {
+      candidate = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return candidate;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::SetRoot(Node<T, V>* node) {
+  header_.root = node;
+  if (node != nullptr) {
+    node->parent = nullptr;
+  }
+  ResetBounds();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::UpdateSize(Node<T, V>* node) {
+  node->size_ = 1 + Size(node->left) + Size(node->right);
+  if constexpr (kAugmented) {
+    UpdateAggregate(node);
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::UpdateAggregate(Node<T, V>* node) {
+  auto value = policy_.Lift(node->key);
+  if (node->left) value = policy_.Combine(node->left->aggregate, value);
+  if (node->right) value = policy_.Combine(value, node->right->aggregate);
+  node->aggregate = std::move(value);
+}
+// Turns node back into a lone leaf before it is linked somewhere else
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::ResetNode(Node<T, V>* node) {
+  node->left = node->right = nullptr;
+  node->height = 1;
+  node->size_ = 1;
+  if constexpr (kAugmented) {
+    UpdateAggregate(node);
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+size_t AVLTree<T, V, Compare, KeyOfValue>::Size(Node<T, V>* node) const {
   if (node) {
     return node->size_;
   }
   return 0;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert(T key) {
-  root = Insert(root, key, nullptr);
-  return root;
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert(const T& key) {
+  return InsertUnique(key);
 }
-
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Insert_multiset(T key) {
-  root = Insert_multiset(root, key, nullptr);
-  return root;
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert(T&& key) {
+  return InsertUnique(std::move(key));
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert(Node<T, V>* hint,
+                                                       const T& key) {
+  return InsertHint(hint, key);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert(Node<T, V>* hint,
+                                                       T&& key) {
+  return InsertHint(hint, std::move(key));
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert_multiset(const T& key) {
+  return InsertEqual(key);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert_multiset(T&& key) {
+  return InsertEqual(std::move(key));
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename... Args>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Emplace_multiset(
+    Args&&... args) {
+  Node<T, V>* node = NewNode(std::in_place, std::forward<Args>(args)...);
+  try {
+    return InsertEqualKey(key_of_(node->key), [node] { return node; });
+  } catch (...) {
+    DeleteNode(node);
+    throw;
+  }
 }
-
-template <typename T, typename V>
-void AVLTree<T, V>::Remove(T key) {
-  root = Remove(root, key);
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Insert_multiset(
+    NodeHandle<T, V>&& handle) {
+  if (handle.empty()) return nullptr;
+  Node<T, V>* node = handle.node_;
+  InsertEqualKey(key_of_(node->key), [this, node] {
+    ResetNode(node);
+    return node;
+  });
+  foreign_ |= node->pool != pool_;
+  handle.node_ = nullptr;
+  return node;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::Search(T key) {
-  return Search(root, key);
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Merge_multiset(AVLTree& other) {
+  if (this == &other || other.header_.root == nullptr) return;
+  Node<T, V>* node = other.header_.leftmost;
+  while (node != nullptr) {
+    Node<T, V>* next = other.Successor(node);
+    InsertEqualKey(key_of_(node->key), [&] {
+      other.Unlink(node);
+      ResetNode(node);
+      foreign_ |= node->pool != pool_;
+      return node;
+    });
+    node = next;
+  }
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::GetRoot() const {
-  return this->root;
+// Cuts out the run of keys equal to key with two splits and joins the
+// rest back: O(log n) plus O(k) to free the k removed nodes
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue>::RemoveAll(const K& key) {
+  Node<T, V>* first = LowerBound(key);
+  if (first == nullptr || comp_(key, key_of_(first->key))) return 0;
+  Node<T, V>* next = Successor(first);
+  if (next == nullptr || comp_(key, key_of_(next->key))) {
+    Remove(first);
+    return 1;
+  }
+  Node<T, V>* left = nullptr;
+  Node<T, V>* rest = nullptr;
+  Node<T, V>* equal = nullptr;
+  Node<T, V>* right = nullptr;
+  SplitBy(exchange(header_.root, nullptr), key, false, left, rest);
+  SplitBy(rest, key, true, equal, right);
+  size_t removed = Size(equal);
+  header_.root = JoinTwo(left, right);
+  ResetBounds();
+  DeleteSubtree(equal);
+  return removed;
 }
-template <typename T, typename V>
-void AVLTree<T, V>::Swap(AVLTree<T, V>& other) {
-  std::swap(root, other.root);
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue>::Count(const K& key) const {
+  size_t not_greater = 0;
+  Node<T, V>* node = header_.root;
+  while (node) {
+    if (comp_(key, key_of_(node->key))) {
+      node = node->left;
+    } else {
+      not_greater += Size(node->left) + 1;
+      node = node->right;
+    }
+  }
+  return not_greater - CountLess(key);
 }
-template <typename T, typename V>
-bool AVLTree<T, V>::GetInserted() {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+void AVLTree<T, V, Compare, KeyOfValue>::Remove(const K& key) {
+  Node<T, V>* node = Search(key);
+  if (node != nullptr) {
+    Remove(node);
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::GetRoot() const {
+  return header_.root;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+const TreeHeader<T, V>* AVLTree<T, V, Compare, KeyOfValue>::GetHeader() const {
+  return &header_;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::ResetBounds() {
+  Node<T, V>* node = header_.root;
+  header_.leftmost = header_.rightmost = node;
+  if (node != nullptr) {
+    header_.leftmost = FindMin(node);
+    while (node->right) node = node->right;
+    header_.rightmost = node;
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Swap(AVLTree& other) {
+  std::swap(header_, other.header_);
+  std::swap(comp_, other.comp_);
+  std::swap(policy_, other.policy_);
+  std::swap(pool_, other.pool_);
+  std::swap(foreign_, other.foreign_);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+bool AVLTree<T, V, Compare, KeyOfValue>::GetInserted() {
   return inserted;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::CopyTree(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::CopyTree(Node<T, V>* node) {
   if (node == nullptr) {
     return nullptr;
   }
-  Node<T, V>* new_node = new Node<T, V>(node->key);
+  Node<T, V>* new_node = NewNode(node->key);
+  new_node->height = node->height;
   new_node->size_ = node->size_;
+  if constexpr (kAugmented) {
+    new_node->aggregate = node->aggregate;
+  }
   new_node->left = CopyTree(node->left);
+  if (new_node->left) new_node->left->parent = new_node;
   new_node->right = CopyTree(node->right);
-  new_node->parent = node->parent;
+  if (new_node->right) new_node->right->parent = new_node;
   return new_node;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::MaximumKey(Node<T, V>* node) {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::MaximumKey(Node<T, V>* node) {
   if (node != nullptr) {
     while (node->right != nullptr) {
       return this->MaximumKey(node->right);
@@ -255,8 +910,332 @@ Node<T, V>* AVLTree<T, V>::MaximumKey(Node<T, V>* node) {
   }
   return nullptr;
 }
-template <typename T, typename V>
-Node<T, V>* AVLTree<T, V>::GetNil() {
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t AVLTree<T, V, Compare, KeyOfValue>::CountLess(const K& key) const {
+  size_t count = 0;
+  Node<T, V>* node = header_.root;
+  while (node) {
+    if (comp_(key_of_(node->key), key)) {
+      count += Size(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return count;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Select(size_t k) const {
+  Node<T, V>* node = header_.root;
+  while (node) {
+    size_t left = Size(node->left);
+    if (k < left) {
+      node = node->left;
+    } else if (k > left) {
+      k -= left + 1;
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+const Compare& AVLTree<T, V, Compare, KeyOfValue>::GetCompare() const {
+  return comp_;
+}
+// Detaches other's nodes for the set algebra to link here or free. They
+// keep their pools alive by themselves; other keeps its pool for later
+// inserts.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::TakeAll(AVLTree& other) {
+  Node<T, V>* root = exchange(other.header_.root, nullptr);
+  other.ResetBounds();
+  if (root != nullptr) foreign_ = true;
+  return root;
+}
+// Links left, node and right into one subtree. Every key of left is less
+// than node's and every key of right is greater. The shorter side is hung
+// on the spine of the taller one at matching height and the spine is
+// rebalanced, so the cost is O(|Height(left) - Height(right)| + 1).
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::Join(Node<T, V>* left,
+                                                     Node<T, V>* node,
+                                                     Node<T, V>* right) {
+  int hl = Height(left);
+  int hr = Height(right);
+  Node<T, V>* parent = nullptr;
+  if (hl > hr + 1) {
+    parent = left;
+    while (Height(parent->right) > hr + 1) parent = parent->right;
+    left = parent->right;
+  } else if (hr > hl + 1) {
+    parent = right;
+    while (Height(parent->left) > hl + 1) parent = parent->left;
+    right = parent->left;
+  }
+  node->left = left;
+  if (left) left->parent = node;
+  node->right = right;
+  if (right) right->parent = node;
+  node->parent = parent;
+  UpdateHeight(node);
+  UpdateSize(node);
+  if (parent == nullptr) {
+    return node;
+  }
+  if (hl > hr + 1) {
+    parent->right = node;
+  } else {
+    parent->left = node;
+  }
+  Rebalance(parent);
+  while (node->parent) node = node->parent;
+  return node;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::JoinTwo(Node<T, V>* left,
+                                                        Node<T, V>* right) {
+  if (left == nullptr) {
+    return right;
+  }
+  Node<T, V>* rest = nullptr;
+  Node<T, V>* last = SplitLast(left, rest);
+  return Join(rest, last, right);
+}
+// Detaches the greatest node of a subtree; rest gets the remaining ones
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::SplitLast(Node<T, V>* node,
+                                                          Node<T, V>*& rest) {
+  Node<T, V>* left = node->left;
+  Node<T, V>* right = node->right;
+  if (left) left->parent = nullptr;
+  if (right == nullptr) {
+    rest = left;
+    return node;
+  }
+  right->parent = nullptr;
+  Node<T, V>* tail = nullptr;
+  Node<T, V>* last = SplitLast(right, tail);
+  rest = Join(left, node, tail);
+  return last;
+}
+// Splits node into the keys less than key (or not greater, when
+// inclusive) and the rest; equal keys may be spread over many nodes here
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+void AVLTree<T, V, Compare, KeyOfValue>::SplitBy(Node<T, V>* node,
+                                                 const K& key, bool inclusive,
+                                                 Node<T, V>*& left,
+                                                 Node<T, V>*& right) {
+  if (node == nullptr) {
+    left = right = nullptr;
+    return;
+  }
+  Node<T, V>* l = node->left;
+  Node<T, V>* r = node->right;
+  if (l) l->parent = nullptr;
+  if (r) r->parent = nullptr;
+  bool goes_left = inclusive ? !comp_(key, key_of_(node->key))
+                             : comp_(key_of_(node->key), key);
+  if (goes_left) {
+    SplitBy(r, key, inclusive, r, right);
+    left = Join(l, node, r);
+  } else {
+    SplitBy(l, key, inclusive, left, l);
+    right = Join(l, node, r);
+  }
+}
+// Splits a subtree into keys less than and greater than key. The node
+// holding key itself, if any, is detached and returned.
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::SplitNode(
+    Node<T, V>* node, const K& key, Node<T, V>*& left, Node<T, V>*& right) {
+  if (node == nullptr) {
+    left = right = nullptr;
+    return nullptr;
+  }
+  Node<T, V>* l = node->left;
+  Node<T, V>* r = node->right;
+  if (l) l->parent = nullptr;
+  if (r) r->parent = nullptr;
+  if (comp_(key, key_of_(node->key))) {
+    Node<T, V>* found = SplitNode(l, key, left, l);
+    right = Join(l, node, r);
+    return found;
+  }
+  if (comp_(key_of_(node->key), key)) {
+    Node<T, V>* found = SplitNode(r, key, r, right);
+    left = Join(l, node, r);
+    return found;
+  }
+  left = l;
+  right = r;
+  node->left = node->right = node->parent = nullptr;
+  return node;
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::UnionNodes(Node<T, V>* a,
+                                                           Node<T, V>* b) {
+  if (a == nullptr) return b;
+  if (b == nullptr) return a;
+  Node<T, V>* la = a->left;
+  Node<T, V>* ra = a->right;
+  if (la) la->parent = nullptr;
+  if (ra) ra->parent = nullptr;
+  Node<T, V>* lb = nullptr;
+  Node<T, V>* rb = nullptr;
+  Node<T, V>* equal = SplitNode(b, key_of_(a->key), lb, rb);
+  if (equal) DeleteNode(equal);
+  Node<T, V>* left = UnionNodes(la, lb);
+  Node<T, V>* right = UnionNodes(ra, rb);
+  return Join(left, a, right);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::IntersectNodes(
+    Node<T, V>* a, Node<T, V>* b) {
+  if (a == nullptr || b == nullptr) {
+    DeleteSubtree(a);
+    DeleteSubtree(b);
+    return nullptr;
+  }
+  Node<T, V>* la = a->left;
+  Node<T, V>* ra = a->right;
+  if (la) la->parent = nullptr;
+  if (ra) ra->parent = nullptr;
+  Node<T, V>* lb = nullptr;
+  Node<T, V>* rb = nullptr;
+  Node<T, V>* equal = SplitNode(b, key_of_(a->key), lb, rb);
+  Node<T, V>* left = IntersectNodes(la, lb);
+  Node<T, V>* right = IntersectNodes(ra, rb);
+  if (equal) {
+    DeleteNode(equal);
+    return Join(left, a, right);
+  }
+  DeleteNode(a);
+  return JoinTwo(left, right);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::DifferenceNodes(
+    Node<T, V>* a, Node<T, V>* b) {
+  if (a == nullptr || b == nullptr) {
+    DeleteSubtree(b);
+    return a;
+  }
+  Node<T, V>* lb = b->left;
+  Node<T, V>* rb = b->right;
+  if (lb) lb->parent = nullptr;
+  if (rb) rb->parent = nullptr;
+  Node<T, V>* la = nullptr;
+  Node<T, V>* ra = nullptr;
+  Node<T, V>* equal = SplitNode(a, key_of_(b->key), la, ra);
+  DeleteNode(b);
+  if (equal) DeleteNode(equal);
+  Node<T, V>* left = DifferenceNodes(la, lb);
+  Node<T, V>* right = DifferenceNodes(ra, rb);
+  return JoinTwo(left, right);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Union(AVLTree& other) {
+  if (this == &other) return;
+  Node<T, V>* a = exchange(header_.root, nullptr);
+  Node<T, V>* b = TakeAll(other);
+  header_.root = UnionNodes(a, b);
+  ResetBounds();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Intersection(AVLTree& other) {
+  if (this == &other) return;
+  Node<T, V>* a = exchange(header_.root, nullptr);
+  Node<T, V>* b = TakeAll(other);
+  header_.root = IntersectNodes(a, b);
+  ResetBounds();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Difference(AVLTree& other) {
+  if (this == &other) {
+    Clear(header_.root);
+    return;
+  }
+  Node<T, V>* a = exchange(header_.root, nullptr);
+  Node<T, V>* b = TakeAll(other);
+  header_.root = DifferenceNodes(a, b);
+  ResetBounds();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+void AVLTree<T, V, Compare, KeyOfValue>::Split(const K& key, AVLTree& other) {
+  if (this == &other) return;
+  other.Clear(other.header_.root);
+  Node<T, V>* left = nullptr;
+  Node<T, V>* right = nullptr;
+  Node<T, V>* equal =
+      SplitNode(exchange(header_.root, nullptr), key, left, right);
+  if (equal) right = Join(nullptr, equal, right);
+  header_.root = left;
+  ResetBounds();
+  other.header_.root = right;
+  other.ResetBounds();
+  other.comp_ = comp_;
+  if (right != nullptr) other.foreign_ = true;
+}
+// Descends to the highest node inside [lo, hi), then folds the in-range
+// parts hanging off the two paths from there towards lo and hi
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+template <typename K>
+auto AVLTree<T, V, Compare, KeyOfValue>::Aggregate(const K& lo,
+                                                   const K& hi) const {
+  auto of = [this](const Node<T, V>* node) {
+    return node ? node->aggregate : policy_.Identity();
+  };
+  Node<T, V>* node = header_.root;
+  while (node != nullptr) {
+    if (comp_(key_of_(node->key), lo)) {
+      node = node->right;
+    } else if (!comp_(key_of_(node->key), hi)) {
+      node = node->left;
+    } else {
+      break;
+    }
+  }
+  if (node == nullptr) return policy_.Identity();
+  auto left = policy_.Identity();
+  for (Node<T, V>* n = node->left; n != nullptr;) {
+    if (comp_(key_of_(n->key), lo)) {
+      n = n->right;
+    } else {
+      left = policy_.Combine(
+          policy_.Combine(policy_.Lift(n->key), of(n->right)), left);
+      n = n->left;
+    }
+  }
+  auto right = policy_.Identity();
+  for (Node<T, V>* n = node->right; n != nullptr;) {
+    if (comp_(key_of_(n->key), hi)) {
+      right = policy_.Combine(
+          right, policy_.Combine(of(n->left), policy_.Lift(n->key)));
+      n = n->right;
+    } else {
+      n = n->left;
+    }
+  }
+  return policy_.Combine(policy_.Combine(left, policy_.Lift(node->key)),
+                         right);
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+auto AVLTree<T, V, Compare, KeyOfValue>::Aggregate() const {
+  return header_.root ? header_.root->aggregate : policy_.Identity();
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+void AVLTree<T, V, Compare, KeyOfValue>::Refresh(Node<T, V>* node) {
+  if constexpr (kAugmented) {
+    for (; node != nullptr; node = node->parent) UpdateAggregate(node);
+  }
+}
+template <typename T, typename V, typename Compare, typename KeyOfValue>
+Node<T, V>* AVLTree<T, V, Compare, KeyOfValue>::GetNil() {
   return nil;
 }
 }  // namespace s21
@@ -0,0 +1,128 @@
+#ifndef SRC_NODE_POOL_H_
+#define SRC_NODE_POOL_H_
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+// Slab allocator for tree nodes. Storage is carved out of slabs that grow
+// geometrically, freed slots go to a free list and are reused first, and
+// Release() hands every slab back at once. The pool only manages raw
+// storage: constructing and destroying the nodes is up to the caller.
+//
+// Nodes may move to another tree and are always freed back to the pool
+// they came from, so a pool lives on the heap and counts the nodes it has
+// handed out. Once its tree has let go of it, it deletes itself with the
+// last of them. Until then every moved node pins its whole pool, which is
+// why the pool object holds a single slot and heap slabs start small.
+template <typename NodeT>
+class NodePool {
+ public:
+  NodePool()
+      : slabs_(nullptr),
+        free_(nullptr),
+        cursor_(&first_),
+        end_(&first_ + 1),
+        slab_slots_(kFirstSlabSlots),
+        live_(0),
+        owned_(true) {}
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+
+  void* Allocate() {
+    ++live_;
+    if (free_ != nullptr) {
+      Slot* slot = free_;
+      free_ = free_->next;
+      return slot;
+    }
+    if (cursor_ == end_) {
+      Grow();
+    }
+    return cursor_++;
+  }
+  void Deallocate(void* ptr) {
+    Slot* slot = static_cast<Slot*>(ptr);
+    slot->next = free_;
+    free_ = slot;
+    --live_;
+    Collect();
+  }
+  // Frees all heap slabs; every node handed out before becomes invalid, so
+  // the caller must hold all of them
+  void Release() {
+    FreeSlabs();
+    free_ = nullptr;
+    cursor_ = &first_;
+    end_ = &first_ + 1;
+    slab_slots_ = kFirstSlabSlots;
+    live_ = 0;
+  }
+  // Called by the tree instead of delete; the nodes still out keep the
+  // pool alive
+  void Disown() {
+    owned_ = false;
+    Collect();
+  }
+  // Nodes handed out and not freed yet
+  size_t Live() const { return live_; }
+  // Heap memory held by the pool, the pool object included
+  size_t Bytes() const {
+    size_t bytes = sizeof(*this);
+    for (const Slot* slab = slabs_; slab != nullptr; slab = slab->head.next) {
+      bytes += slab->head.slots * sizeof(Slot);
+    }
+    return bytes;
+  }
+
+ private:
+  union Slot {
+    Slot* next;
+    struct {
+      Slot* next;
+      size_t slots;
+    } head;
+    alignas(NodeT) unsigned char storage[sizeof(NodeT)];
+  };
+  static constexpr size_t kFirstSlabSlots = 4;
+  static constexpr size_t kMaxSlabSlots = 4096;
+
+  // The first slot of every heap slab is its head in the slab list
+  Slot* slabs_;
+  Slot* free_;
+  Slot* cursor_;
+  Slot* end_;
+  size_t slab_slots_;
+  size_t live_;
+  bool owned_;
+  Slot first_;
+
+  ~NodePool() { FreeSlabs(); }
+  void Collect() {
+    if (!owned_ && live_ == 0) {
+      delete this;
+    }
+  }
+  void FreeSlabs() {
+    while (slabs_ != nullptr) {
+      Slot* next = slabs_->head.next;
+      ::operator delete(slabs_);
+      slabs_ = next;
+    }
+  }
+  void Grow() {
+    Slot* slab = static_cast<Slot*>(::operator new(slab_slots_ * sizeof(Slot)));
+    slab->head.next = slabs_;
+    slab->head.slots = slab_slots_;
+    slabs_ = slab;
+    cursor_ = slab + 1;
+    end_ = slab + slab_slots_;
+    if (slab_slots_ < kMaxSlabSlots) {
+      slab_slots_ *= 2;
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_NODE_POOL_H_
@@ -0,0 +1,126 @@
+#ifndef SRC_BTREE_H_
+#define SRC_BTREE_H_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "../avlTree/s21_avl_tree.h"
+#include "s21_btree_iterator.h"
+
+namespace s21 {
+// B-tree behind btree_set, btree_map and btree_multiset. A lookup touches
+// one node per level, and a node holds dozens of small keys, so a tree of
+// 1e8 ints is five levels deep against the AVL tree's ~30 dependent loads.
+// Inside a node, arithmetic keys under std::less or std::greater are
+// searched by counting the smaller keys in one branch-free pass that the
+// compiler vectorizes; other keys are binary searched.
+//
+// Elements move between nodes on splits and merges, so every insert and
+// erase invalidates all iterators.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
+class BTree {
+ public:
+  using Node = BTreeNode<T>;
+  using iterator = BTreeIterator<T, false>;
+  using const_iterator = BTreeIterator<T, true>;
+  using key_type =
+      std::decay_t<decltype(std::declval<KeyOfValue>()(std::declval<T&>()))>;
+
+  BTree();
+  explicit BTree(const Compare& comp);
+  BTree(const BTree& other);
+  BTree(BTree&& other) noexcept;
+  BTree& operator=(BTree other) noexcept;
+  ~BTree();
+
+  iterator Begin() const;
+  iterator End() const;
+  size_t Size() const;
+  void Clear();
+  void Swap(BTree& other) noexcept;
+
+  template <typename K>
+  iterator Find(const K& key) const;
+  template <typename K>
+  iterator LowerBound(const K& key) const;
+  template <typename K>
+  iterator UpperBound(const K& key) const;
+  template <typename K>
+  size_t Count(const K& key) const;
+
+  // Unique keys. Appending past the maximum skips the descent.
+  template <typename U>
+  std::pair<iterator, bool> InsertUnique(U&& value);
+  // Constructs the element from args only when key is absent
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args);
+  // O(1) amortized when value belongs right before or after hint
+  template <typename U>
+  iterator InsertHintUnique(iterator hint, U&& value);
+  // Equal keys allowed; a new element goes after its equals
+  template <typename U>
+  iterator InsertEqual(U&& value);
+
+  void Erase(iterator pos);
+  template <typename K>
+  size_t EraseUnique(const K& key);
+  template <typename K>
+  size_t EraseEqual(const K& key);
+
+  const Node* GetRoot() const;
+  int Height() const;
+  const Compare& GetCompare() const;
+  const KeyOfValue& GetKeyOfValue() const;
+
+ private:
+  static constexpr int kSlots = Node::kSlots;
+  static constexpr int kMinSlots = Node::kMinSlots;
+  static constexpr bool kLinearSearch =
+      std::is_arithmetic<key_type>::value &&
+      (std::is_same<Compare, std::less<key_type>>::value ||
+       std::is_same<Compare, std::greater<key_type>>::value);
+
+  Node* root_;
+  size_t size_;
+  Compare comp_;
+  KeyOfValue key_of_;
+
+  const key_type& Key(const Node* node, int i) const;
+  // First slot not less than key, or first slot greater than key
+  template <typename K>
+  int LowerIndex(const Node* node, const K& key) const;
+  template <typename K>
+  int UpperIndex(const Node* node, const K& key) const;
+  Node* Leftmost() const;
+  Node* Rightmost() const;
+
+  // Makes room at pos of a leaf, splitting it when full, and builds the
+  // element there from args
+  template <typename... Args>
+  iterator InsertAt(Node* node, int pos, Args&&... args);
+  template <typename U>
+  iterator InsertBefore(iterator pos, U&& value);
+  // Moves the upper half of a full node into a new right sibling and its
+  // middle slot up to the parent. An append, at the end of the rightmost
+  // node, moves nothing but the last slot up.
+  Node* Split(Node* node, bool append);
+  void InsertIntoParent(Node* left, T&& separator, Node* right,
+                        bool append);
+  // Restores the minimum fill of node by borrowing from or merging with a
+  // sibling, then of its ancestors
+  void Rebalance(Node* node);
+  void BorrowFromLeft(Node* node, Node* left);
+  void BorrowFromRight(Node* node, Node* right);
+  void MergeWithRight(Node* left);
+
+  static void MoveSlot(Node* from, int i, Node* to, int j);
+  static void ShiftRight(Node* node, int from);
+  static void ShiftLeft(Node* node, int from);
+  static Node* Clone(const Node* node);
+  static void Destroy(Node* node);
+};
+}  // namespace s21
+
+#endif  // SRC_BTREE_H_
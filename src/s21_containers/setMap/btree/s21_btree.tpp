@@ -0,0 +1,533 @@
+#ifndef BTREE_TPP
+#define BTREE_TPP
+#include "s21_btree.h"
+namespace s21 {
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>::BTree() : BTree(Compare()) {}
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>::BTree(const Compare& comp)
+    : root_(nullptr), size_(0), comp_(comp), key_of_() {}
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>::BTree(const BTree& other)
+    : root_(other.root_ ? Clone(other.root_) : nullptr),
+      size_(other.size_),
+      comp_(other.comp_),
+      key_of_(other.key_of_) {}
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>::BTree(BTree&& other) noexcept
+    : BTree(other.comp_) {
+  Swap(other);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>& BTree<T, Compare, KeyOfValue>::operator=(
+    BTree other) noexcept {
+  Swap(other);
+  return *this;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+BTree<T, Compare, KeyOfValue>::~BTree() {
+  Clear();
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::Begin() const {
+  if (root_ == nullptr) return iterator();
+  return iterator(Leftmost(), 0);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::End() const {
+  if (root_ == nullptr) return iterator();
+  Node* node = Rightmost();
+  return iterator(node, node->count);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+size_t BTree<T, Compare, KeyOfValue>::Size() const {
+  return size_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::Clear() {
+  if (root_ != nullptr) Destroy(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::Swap(BTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+  std::swap(key_of_, other.key_of_);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::Find(const K& key) const {
+  iterator it = LowerBound(key);
+  if (it == End() || comp_(key, key_of_(*it))) return End();
+  return it;
+}
+// The deepest candidate seen on the way down is the smallest one
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::LowerBound(const K& key) const {
+  iterator result = End();
+  for (Node* node = root_; node != nullptr;) {
+    int i = LowerIndex(node, key);
+    if (i < node->count) result = iterator(node, i);
+    if (node->leaf) break;
+    node = node->Child(i);
+  }
+  return result;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::UpperBound(const K& key) const {
+  iterator result = End();
+  for (Node* node = root_; node != nullptr;) {
+    int i = UpperIndex(node, key);
+    if (i < node->count) result = iterator(node, i);
+    if (node->leaf) break;
+    node = node->Child(i);
+  }
+  return result;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t BTree<T, Compare, KeyOfValue>::Count(const K& key) const {
+  size_t count = 0;
+  iterator end = End();
+  for (iterator it = LowerBound(key); it != end && !comp_(key, key_of_(*it));
+       ++it) {
+    count++;
+  }
+  return count;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+std::pair<typename BTree<T, Compare, KeyOfValue>::iterator, bool>
+BTree<T, Compare, KeyOfValue>::InsertUnique(U&& value) {
+  return TryEmplace(key_of_(value), std::forward<U>(value));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K, typename... Args>
+std::pair<typename BTree<T, Compare, KeyOfValue>::iterator, bool>
+BTree<T, Compare, KeyOfValue>::TryEmplace(const K& key, Args&&... args) {
+  if (root_ == nullptr) {
+    root_ = Node::New(true);
+    return {InsertAt(root_, 0, std::forward<Args>(args)...), true};
+  }
+  Node* last = Rightmost();
+  if (comp_(Key(last, last->count - 1), key)) {
+    return {InsertAt(last, last->count, std::forward<Args>(args)...), true};
+  }
+  Node* node = root_;
+  for (;;) {
+    int i = LowerIndex(node, key);
+    if (i < node->count && !comp_(key, Key(node, i))) {
+      return {iterator(node, i), false};
+    }
+    if (node->leaf) {
+      return {InsertAt(node, i, std::forward<Args>(args)...), true};
+    }
+    node = node->Child(i);
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::InsertHintUnique(iterator hint, U&& value) {
+  if (root_ == nullptr) return InsertUnique(std::forward<U>(value)).first;
+  const auto& key = key_of_(value);
+  if (hint == End() || comp_(key, key_of_(*hint))) {
+    iterator prev = hint;
+    if (hint == Begin() || comp_(key_of_(*--prev), key)) {
+      return InsertBefore(hint, std::forward<U>(value));
+    }
+  } else if (comp_(key_of_(*hint), key)) {
+    iterator next = hint;
+    if (++next == End() || comp_(key, key_of_(*next))) {
+      return InsertBefore(next, std::forward<U>(value));
+    }
+  } else {
+    return hint;
+  }
+  return InsertUnique(std::forward<U>(value)).first;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::InsertEqual(U&& value) {
+  if (root_ == nullptr) {
+    root_ = Node::New(true);
+    return InsertAt(root_, 0, std::forward<U>(value));
+  }
+  const auto& key = key_of_(value);
+  Node* last = Rightmost();
+  if (!comp_(key, Key(last, last->count - 1))) {
+    return InsertAt(last, last->count, std::forward<U>(value));
+  }
+  Node* node = root_;
+  int i = UpperIndex(node, key);
+  while (!node->leaf) {
+    node = node->Child(i);
+    i = UpperIndex(node, key);
+  }
+  return InsertAt(node, i, std::forward<U>(value));
+}
+
+// An element in an internal node trades places with its predecessor, the
+// last slot of a leaf, so that removal always happens in a leaf
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::Erase(iterator pos) {
+  Node* node = pos.node();
+  int i = pos.position();
+  if (!node->leaf) {
+    Node* leaf = node->Child(i);
+    while (!leaf->leaf) leaf = leaf->Child(leaf->count);
+    node->Slot(i).~T();
+    MoveSlot(leaf, leaf->count - 1, node, i);
+    leaf->count--;
+    node = leaf;
+  } else {
+    node->Slot(i).~T();
+    ShiftLeft(node, i + 1);
+    node->count--;
+  }
+  size_--;
+  Rebalance(node);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t BTree<T, Compare, KeyOfValue>::EraseUnique(const K& key) {
+  iterator it = Find(key);
+  if (it == End()) return 0;
+  Erase(it);
+  return 1;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t BTree<T, Compare, KeyOfValue>::EraseEqual(const K& key) {
+  size_t erased = 0;
+  for (iterator it = Find(key); it != End(); it = Find(key)) {
+    Erase(it);
+    erased++;
+  }
+  return erased;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+const typename BTree<T, Compare, KeyOfValue>::Node*
+BTree<T, Compare, KeyOfValue>::GetRoot() const {
+  return root_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+int BTree<T, Compare, KeyOfValue>::Height() const {
+  int height = 0;
+  for (Node* node = root_; node != nullptr;
+       node = node->leaf ? nullptr : node->Child(0)) {
+    height++;
+  }
+  return height;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const Compare& BTree<T, Compare, KeyOfValue>::GetCompare() const {
+  return comp_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const KeyOfValue& BTree<T, Compare, KeyOfValue>::GetKeyOfValue() const {
+  return key_of_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+const typename BTree<T, Compare, KeyOfValue>::key_type&
+BTree<T, Compare, KeyOfValue>::Key(const Node* node, int i) const {
+  return key_of_(node->Slot(i));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+int BTree<T, Compare, KeyOfValue>::LowerIndex(const Node* node,
+                                              const K& key) const {
+  if constexpr (kLinearSearch) {
+    int less = 0;
+    for (int i = 0; i < node->count; i++) less += comp_(Key(node, i), key);
+    return less;
+  } else {
+    int lo = 0;
+    int hi = node->count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (comp_(Key(node, mid), key)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+int BTree<T, Compare, KeyOfValue>::UpperIndex(const Node* node,
+                                              const K& key) const {
+  if constexpr (kLinearSearch) {
+    int not_greater = 0;
+    for (int i = 0; i < node->count; i++) {
+      not_greater += !comp_(key, Key(node, i));
+    }
+    return not_greater;
+  } else {
+    int lo = 0;
+    int hi = node->count;
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (!comp_(key, Key(node, mid))) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::Node*
+BTree<T, Compare, KeyOfValue>::Leftmost() const {
+  Node* node = root_;
+  while (!node->leaf) node = node->Child(0);
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::Node*
+BTree<T, Compare, KeyOfValue>::Rightmost() const {
+  Node* node = root_;
+  while (!node->leaf) node = node->Child(node->count);
+  return node;
+}
+
+// Splitting a full node for an append leaves it full, so that sorted input
+// packs the nodes instead of leaving them half empty. Only the rightmost
+// nodes can then be short of kMinSlots, and the next appends fill them.
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename... Args>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::InsertAt(Node* node, int pos,
+                                        Args&&... args) {
+  if (node->count == kSlots) {
+    bool append = pos == kSlots && node == Rightmost();
+    int left_count = append ? kSlots - 1 : kSlots / 2;
+    Node* right = Split(node, append);
+    if (pos > left_count) {
+      node = right;
+      pos -= left_count + 1;
+    }
+  }
+  ShiftRight(node, pos);
+  try {
+    new (&node->Slot(pos)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    // Close the hole again; a split may have left node short, or the
+    // root empty
+    for (int i = pos + 1; i <= node->count; i++) MoveSlot(node, i, node, i - 1);
+    Rebalance(node);
+    throw;
+  }
+  node->count++;
+  size_++;
+  return iterator(node, pos);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename BTree<T, Compare, KeyOfValue>::iterator
+BTree<T, Compare, KeyOfValue>::InsertBefore(iterator pos, U&& value) {
+  if (pos.node()->leaf) {
+    return InsertAt(pos.node(), pos.position(), std::forward<U>(value));
+  }
+  // The predecessor of an internal slot ends a leaf
+  --pos;
+  return InsertAt(pos.node(), pos.position() + 1, std::forward<U>(value));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::Node*
+BTree<T, Compare, KeyOfValue>::Split(Node* node, bool append) {
+  int left_count = append ? kSlots - 1 : kSlots / 2;
+  Node* right = Node::New(node->leaf);
+  int moved = node->count - left_count - 1;
+  for (int i = 0; i < moved; i++) MoveSlot(node, left_count + 1 + i, right, i);
+  if (!node->leaf) {
+    for (int i = 0; i <= moved; i++) {
+      right->SetChild(i, node->Child(left_count + 1 + i));
+    }
+  }
+  right->count = static_cast<uint8_t>(moved);
+  T separator(std::move(node->Slot(left_count)));
+  node->Slot(left_count).~T();
+  node->count = static_cast<uint8_t>(left_count);
+  InsertIntoParent(node, std::move(separator), right, append);
+  return right;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::InsertIntoParent(Node* left,
+                                                     T&& separator,
+                                                     Node* right,
+                                                     bool append) {
+  if (left == root_) {
+    root_ = Node::New(false);
+    new (&root_->Slot(0)) T(std::move(separator));
+    root_->count = 1;
+    root_->SetChild(0, left);
+    root_->SetChild(1, right);
+    return;
+  }
+  Node* parent = left->parent;
+  if (parent->count == kSlots) {
+    Split(parent, append);
+    // left may have moved to the new sibling
+    parent = left->parent;
+  }
+  int index = left->position;
+  ShiftRight(parent, index);
+  for (int i = parent->count; i > index; i--) {
+    parent->SetChild(i + 1, parent->Child(i));
+  }
+  new (&parent->Slot(index)) T(std::move(separator));
+  parent->SetChild(index + 1, right);
+  parent->count++;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::Rebalance(Node* node) {
+  while (node != root_ && node->count < kMinSlots) {
+    Node* parent = node->parent;
+    int index = node->position;
+    Node* left = index > 0 ? parent->Child(index - 1) : nullptr;
+    Node* right = index < parent->count ? parent->Child(index + 1) : nullptr;
+    if (left != nullptr && left->count > kMinSlots) {
+      BorrowFromLeft(node, left);
+      return;
+    }
+    if (right != nullptr && right->count > kMinSlots) {
+      BorrowFromRight(node, right);
+      return;
+    }
+    MergeWithRight(left != nullptr ? left : node);
+    node = parent;
+  }
+  if (node == root_ && root_->count == 0) {
+    Node* old = root_;
+    root_ = old->leaf ? nullptr : old->Child(0);
+    if (root_ != nullptr) root_->parent = nullptr;
+    Node::Delete(old);
+  }
+}
+// The separator comes down into node and left's last slot replaces it
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::BorrowFromLeft(Node* node, Node* left) {
+  Node* parent = node->parent;
+  int separator = left->position;
+  ShiftRight(node, 0);
+  MoveSlot(parent, separator, node, 0);
+  MoveSlot(left, left->count - 1, parent, separator);
+  if (!node->leaf) {
+    for (int i = node->count; i >= 0; i--) {
+      node->SetChild(i + 1, node->Child(i));
+    }
+    node->SetChild(0, left->Child(left->count));
+  }
+  left->count--;
+  node->count++;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::BorrowFromRight(Node* node,
+                                                    Node* right) {
+  Node* parent = node->parent;
+  int separator = node->position;
+  MoveSlot(parent, separator, node, node->count);
+  MoveSlot(right, 0, parent, separator);
+  ShiftLeft(right, 1);
+  if (!node->leaf) {
+    node->SetChild(node->count + 1, right->Child(0));
+    for (int i = 0; i < right->count; i++) {
+      right->SetChild(i, right->Child(i + 1));
+    }
+  }
+  right->count--;
+  node->count++;
+}
+// left absorbs the separator and its right sibling, which is freed
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::MergeWithRight(Node* left) {
+  Node* parent = left->parent;
+  int separator = left->position;
+  Node* right = parent->Child(separator + 1);
+  MoveSlot(parent, separator, left, left->count);
+  for (int i = 0; i < right->count; i++) {
+    MoveSlot(right, i, left, left->count + 1 + i);
+  }
+  if (!left->leaf) {
+    for (int i = 0; i <= right->count; i++) {
+      left->SetChild(left->count + 1 + i, right->Child(i));
+    }
+  }
+  left->count = static_cast<uint8_t>(left->count + 1 + right->count);
+  Node::Delete(right);
+  ShiftLeft(parent, separator + 1);
+  for (int i = separator + 1; i < parent->count; i++) {
+    parent->SetChild(i, parent->Child(i + 1));
+  }
+  parent->count--;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::MoveSlot(Node* from, int i, Node* to,
+                                             int j) {
+  new (&to->Slot(j)) T(std::move(from->Slot(i)));
+  from->Slot(i).~T();
+}
+// Opens a hole at from; count is left for the caller to update
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::ShiftRight(Node* node, int from) {
+  for (int i = node->count; i > from; i--) MoveSlot(node, i - 1, node, i);
+}
+// Closes the hole at from - 1
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::ShiftLeft(Node* node, int from) {
+  for (int i = from; i < node->count; i++) MoveSlot(node, i, node, i - 1);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename BTree<T, Compare, KeyOfValue>::Node*
+BTree<T, Compare, KeyOfValue>::Clone(const Node* node) {
+  Node* copy = Node::New(node->leaf);
+  int slots = 0;
+  int children = 0;
+  try {
+    for (; slots < node->count; slots++) {
+      new (&copy->Slot(slots)) T(node->Slot(slots));
+    }
+    if (!node->leaf) {
+      for (; children <= node->count; children++) {
+        copy->SetChild(children, Clone(node->Child(children)));
+      }
+    }
+  } catch (...) {
+    for (int i = 0; i < children; i++) Destroy(copy->Child(i));
+    for (int i = 0; i < slots; i++) copy->Slot(i).~T();
+    Node::Delete(copy);
+    throw;
+  }
+  copy->count = node->count;
+  return copy;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void BTree<T, Compare, KeyOfValue>::Destroy(Node* node) {
+  if (!node->leaf) {
+    for (int i = 0; i <= node->count; i++) Destroy(node->Child(i));
+  }
+  for (int i = 0; i < node->count; i++) node->Slot(i).~T();
+  Node::Delete(node);
+}
+}  // namespace s21
+#endif  // BTREE_TPP
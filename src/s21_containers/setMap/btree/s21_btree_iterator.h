@@ -0,0 +1,99 @@
+#ifndef SRC_BTREE_ITERATOR_H_
+#define SRC_BTREE_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_btree_node.h"
+
+namespace s21 {
+// Bidirectional iterator over a BTree: a node and a slot in it. end() is
+// one past the last slot of the rightmost leaf. Any insert or erase may
+// move elements between nodes and so invalidates every iterator.
+template <typename T, bool kConst>
+class BTreeIterator {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using reference = std::conditional_t<kConst, const T&, T&>;
+  using pointer = std::conditional_t<kConst, const T*, T*>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using Node = BTreeNode<T>;
+
+  BTreeIterator() : node_(nullptr), position_(0) {}
+  BTreeIterator(Node* node, int position)
+      : node_(node), position_(position) {}
+  // iterator converts to const_iterator
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  BTreeIterator(const BTreeIterator<T, kOther>& other)
+      : node_(other.node()), position_(other.position()) {}
+
+  reference operator*() const { return node_->Slot(position_); }
+  pointer operator->() const { return &node_->Slot(position_); }
+  BTreeIterator& operator++() {
+    if (node_->leaf) {
+      if (++position_ < node_->count) return *this;
+      // Climb while this was the last slot; past the root's end is end()
+      Node* node = node_;
+      int position = position_;
+      while (position == node->count && node->parent != nullptr) {
+        position = node->position;
+        node = node->parent;
+      }
+      if (position < node->count) {
+        node_ = node;
+        position_ = position;
+      }
+    } else {
+      node_ = node_->Child(position_ + 1);
+      while (!node_->leaf) node_ = node_->Child(0);
+      position_ = 0;
+    }
+    return *this;
+  }
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  BTreeIterator& operator--() {
+    if (node_->leaf) {
+      if (position_ > 0) {
+        --position_;
+        return *this;
+      }
+      while (position_ == 0 && node_->parent != nullptr) {
+        position_ = node_->position;
+        node_ = node_->parent;
+      }
+      --position_;
+    } else {
+      node_ = node_->Child(position_);
+      while (!node_->leaf) node_ = node_->Child(node_->count);
+      position_ = node_->count - 1;
+    }
+    return *this;
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const BTreeIterator& other) const {
+    return node_ == other.node_ && position_ == other.position_;
+  }
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+  Node* node() const { return node_; }
+  int position() const { return position_; }
+
+ private:
+  Node* node_;
+  int position_;
+};
+}  // namespace s21
+
+#endif  // SRC_BTREE_ITERATOR_H_
@@ -0,0 +1,124 @@
+#ifndef AVL_BTREE_MAP_H_
+#define AVL_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_btree.tpp"
+
+namespace s21 {
+// map on a B-tree, see btree_set. Elements are relocated by move when
+// nodes split or merge, and the const key of value_type is copied then.
+// References and iterators are invalidated by any insert or erase.
+template <typename T, typename V, typename Compare = std::less<T>>
+class btree_map {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using key_compare = Compare;
+  using tree_type = BTree<value_type, Compare, SelectFirst<value_type>>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  class value_compare {
+   public:
+    explicit value_compare(const Compare& comp = Compare()) : comp_(comp) {}
+    bool operator()(const value_type& a, const value_type& b) const {
+      return comp_(a.first, b.first);
+    }
+
+   private:
+    Compare comp_;
+  };
+
+  btree_map() = default;
+  explicit btree_map(const Compare& comp);
+  btree_map(std::initializer_list<value_type> const& items);
+  // O(n) for input sorted by key
+  template <typename InputIt>
+  btree_map(InputIt first, InputIt last);
+  btree_map(const btree_map& m) = default;
+  btree_map(btree_map&& m) = default;
+  btree_map& operator=(const btree_map& m) = default;
+  btree_map& operator=(btree_map&& m) = default;
+  ~btree_map() = default;
+
+  mapped_type& at(const T& key);
+  const mapped_type& at(const T& key) const;
+  mapped_type& operator[](const T& key);
+  mapped_type& operator[](T&& key);
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // Amortized O(1) when value belongs right next to hint
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  // The mapped value is built from args only when the key is absent
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(btree_map& other);
+  // Moves over the elements of other whose keys are not here yet;
+  // elements with a key already present stay in other
+  void merge(btree_map& other);
+  // Iterators would not survive the later inserts: returns whether each
+  // argument was inserted
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with lo <= key < hi
+  IteratorRange<iterator> range(const T& lo, const T& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_BTREE_MAP_H_
@@ -0,0 +1,257 @@
+#include "s21_btree_map.h"
+
+namespace s21 {
+template <typename T, typename V, typename Compare>
+btree_map<T, V, Compare>::btree_map(const Compare& comp) : tree_(comp) {}
+template <typename T, typename V, typename Compare>
+btree_map<T, V, Compare>::btree_map(
+    std::initializer_list<value_type> const& items)
+    : btree_map(items.begin(), items.end()) {}
+template <typename T, typename V, typename Compare>
+template <typename InputIt>
+btree_map<T, V, Compare>::btree_map(InputIt first, InputIt last) : tree_() {
+  for (; first != last; ++first) {
+    const value_type& value = *first;
+    tree_.InsertUnique(value);
+  }
+}
+
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::mapped_type& btree_map<T, V, Compare>::at(
+    const T& key) {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return it->second;
+}
+template <typename T, typename V, typename Compare>
+const typename btree_map<T, V, Compare>::mapped_type&
+btree_map<T, V, Compare>::at(const T& key) const {
+  iterator it = tree_.Find(key);
+  if (it == tree_.End()) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return it->second;
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::mapped_type&
+btree_map<T, V, Compare>::operator[](const T& key) {
+  return try_emplace(key).first->second;
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::mapped_type&
+btree_map<T, V, Compare>::operator[](T&& key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::begin()
+    const {
+  return tree_.Begin();
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::end()
+    const {
+  return tree_.End();
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::reverse_iterator
+btree_map<T, V, Compare>::rbegin() const {
+  return reverse_iterator(end());
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::reverse_iterator
+btree_map<T, V, Compare>::rend() const {
+  return reverse_iterator(begin());
+}
+
+template <typename T, typename V, typename Compare>
+bool btree_map<T, V, Compare>::empty() const {
+  return tree_.Size() == 0;
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::size_type btree_map<T, V, Compare>::size()
+    const {
+  return tree_.Size();
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::size_type
+btree_map<T, V, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+template <typename T, typename V, typename Compare>
+void btree_map<T, V, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::insert(const value_type& value) {
+  return tree_.InsertUnique(value);
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::insert(value_type&& value) {
+  return tree_.InsertUnique(std::move(value));
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::insert(
+    iterator hint, const value_type& value) {
+  return tree_.InsertHintUnique(hint, value);
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::insert(
+    iterator hint, value_type&& value) {
+  return tree_.InsertHintUnique(hint, std::move(value));
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::insert(const key_type& key, const mapped_type& obj) {
+  return try_emplace(key, obj);
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::emplace(Args&&... args) {
+  return tree_.InsertUnique(value_type(std::forward<Args>(args)...));
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+typename btree_map<T, V, Compare>::iterator
+btree_map<T, V, Compare>::emplace_hint(iterator hint, Args&&... args) {
+  return tree_.InsertHintUnique(hint, value_type(std::forward<Args>(args)...));
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::try_emplace(const key_type& key, Args&&... args) {
+  return tree_.TryEmplace(key, std::piecewise_construct,
+                          std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::try_emplace(key_type&& key, Args&&... args) {
+  // key is only moved from once its slot is found
+  return tree_.TryEmplace(key, std::piecewise_construct,
+                          std::forward_as_tuple(std::move(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+}
+template <typename T, typename V, typename Compare>
+template <typename M>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::insert_or_assign(const key_type& key, M&& obj) {
+  auto result = try_emplace(key, std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+template <typename T, typename V, typename Compare>
+template <typename M>
+std::pair<typename btree_map<T, V, Compare>::iterator, bool>
+btree_map<T, V, Compare>::insert_or_assign(key_type&& key, M&& obj) {
+  auto result = try_emplace(std::move(key), std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+template <typename T, typename V, typename Compare>
+void btree_map<T, V, Compare>::erase(iterator pos) {
+  tree_.Erase(pos);
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::size_type btree_map<T, V, Compare>::erase(
+    const T& key) {
+  return tree_.EraseUnique(key);
+}
+template <typename T, typename V, typename Compare>
+void btree_map<T, V, Compare>::swap(btree_map& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+void btree_map<T, V, Compare>::merge(btree_map& other) {
+  if (this == &other) return;
+  tree_type rest(other.tree_.GetCompare());
+  for (auto it = other.tree_.Begin(); it != other.tree_.End(); ++it) {
+    if (!tree_.InsertUnique(std::move(*it)).second) {
+      // Sorted, so every leftover is appended to the last leaf
+      rest.InsertUnique(std::move(*it));
+    }
+  }
+  other.tree_.Swap(rest);
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+s21::vector<bool> btree_map<T, V, Compare>::insert_many(Args&&... args) {
+  s21::vector<bool> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(insert(std::forward<Args>(args)).second), ...);
+  return result;
+}
+
+template <typename T, typename V, typename Compare>
+bool btree_map<T, V, Compare>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::find(
+    const T& key) const {
+  return tree_.Find(key);
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator
+btree_map<T, V, Compare>::lower_bound(const T& key) const {
+  return tree_.LowerBound(key);
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::iterator
+btree_map<T, V, Compare>::upper_bound(const T& key) const {
+  return tree_.UpperBound(key);
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename btree_map<T, V, Compare>::iterator,
+          typename btree_map<T, V, Compare>::iterator>
+btree_map<T, V, Compare>::equal_range(const T& key) const {
+  iterator first = lower_bound(key);
+  if (first == end() || tree_.GetCompare()(key, first->first)) {
+    return std::make_pair(first, first);
+  }
+  iterator last = first;
+  return std::make_pair(first, ++last);
+}
+template <typename T, typename V, typename Compare>
+IteratorRange<typename btree_map<T, V, Compare>::iterator>
+btree_map<T, V, Compare>::range(const T& lo, const T& hi) const {
+  iterator first = lower_bound(lo);
+  iterator last = lower_bound(hi);
+  if (!tree_.GetCompare()(lo, hi)) last = first;
+  return IteratorRange<iterator>(first, last);
+}
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+bool btree_map<T, V, Compare>::contains(const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+typename btree_map<T, V, Compare>::iterator btree_map<T, V, Compare>::find(
+    const K& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::key_compare
+btree_map<T, V, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename V, typename Compare>
+typename btree_map<T, V, Compare>::value_compare
+btree_map<T, V, Compare>::value_comp() const {
+  return value_compare(tree_.GetCompare());
+}
+template <typename T, typename V, typename Compare>
+const typename btree_map<T, V, Compare>::tree_type&
+btree_map<T, V, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
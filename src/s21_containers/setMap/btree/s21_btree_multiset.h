@@ -0,0 +1,79 @@
+#ifndef AVL_BTREE_MULTISET_H_
+#define AVL_BTREE_MULTISET_H_
+
+#include <initializer_list>
+#include <limits>
+
+#include "../../vector/s21_vector.tpp"
+#include "s21_btree.tpp"
+
+namespace s21 {
+// multiset on a B-tree, see btree_set. Equal elements keep their order of
+// insertion. Any insert or erase invalidates all iterators.
+template <typename T, typename Compare = std::less<T>>
+class btree_multiset {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using tree_type = BTree<T, Compare>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  btree_multiset() = default;
+  explicit btree_multiset(const Compare& comp);
+  btree_multiset(std::initializer_list<value_type> const& items);
+  // O(n) for sorted input
+  template <typename InputIt>
+  btree_multiset(InputIt first, InputIt last);
+  btree_multiset(const btree_multiset& ms) = default;
+  btree_multiset(btree_multiset&& ms) = default;
+  btree_multiset& operator=(const btree_multiset& ms) = default;
+  btree_multiset& operator=(btree_multiset&& ms) = default;
+  ~btree_multiset() = default;
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  // Amortized O(1) for a key not less than the current maximum
+  iterator insert(const T& value);
+  iterator insert(T&& value);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  void erase(iterator pos);
+  // Removes all copies of key: O(k log n) for k copies
+  size_type erase(const T& key);
+  void swap(btree_multiset& other);
+  // Moves every element of other over, other ends empty
+  void merge(btree_multiset& other);
+  template <typename... Args>
+  size_type insert_many(Args&&... args);
+
+  size_type count(const T& key) const;
+  // find returns the first of the equal keys
+  iterator find(const T& key) const;
+  bool contains(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_BTREE_MULTISET_H_
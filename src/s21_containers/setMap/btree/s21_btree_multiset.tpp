@@ -0,0 +1,144 @@
+#include "s21_btree_multiset.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+btree_multiset<T, Compare>::btree_multiset(const Compare& comp)
+    : tree_(comp) {}
+template <typename T, typename Compare>
+btree_multiset<T, Compare>::btree_multiset(
+    std::initializer_list<value_type> const& items)
+    : btree_multiset(items.begin(), items.end()) {}
+template <typename T, typename Compare>
+template <typename InputIt>
+btree_multiset<T, Compare>::btree_multiset(InputIt first, InputIt last)
+    : tree_() {
+  for (; first != last; ++first) tree_.InsertEqual(*first);
+}
+
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::begin() const {
+  return tree_.Begin();
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::end() const {
+  return tree_.End();
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::reverse_iterator
+btree_multiset<T, Compare>::rbegin() const {
+  return reverse_iterator(end());
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::reverse_iterator
+btree_multiset<T, Compare>::rend() const {
+  return reverse_iterator(begin());
+}
+
+template <typename T, typename Compare>
+bool btree_multiset<T, Compare>::empty() const {
+  return tree_.Size() == 0;
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::size_type
+btree_multiset<T, Compare>::size() const {
+  return tree_.Size();
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::size_type
+btree_multiset<T, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename Compare>
+void btree_multiset<T, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::insert(const T& value) {
+  return tree_.InsertEqual(value);
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::insert(T&& value) {
+  return tree_.InsertEqual(std::move(value));
+}
+template <typename T, typename Compare>
+template <typename... Args>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::emplace(Args&&... args) {
+  return tree_.InsertEqual(T(std::forward<Args>(args)...));
+}
+template <typename T, typename Compare>
+void btree_multiset<T, Compare>::erase(iterator pos) {
+  tree_.Erase({pos.node(), pos.position()});
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::size_type
+btree_multiset<T, Compare>::erase(const T& key) {
+  return tree_.EraseEqual(key);
+}
+template <typename T, typename Compare>
+void btree_multiset<T, Compare>::swap(btree_multiset& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename Compare>
+void btree_multiset<T, Compare>::merge(btree_multiset& other) {
+  if (this == &other) return;
+  for (auto it = other.tree_.Begin(); it != other.tree_.End(); ++it) {
+    tree_.InsertEqual(std::move(*it));
+  }
+  other.clear();
+}
+template <typename T, typename Compare>
+template <typename... Args>
+typename btree_multiset<T, Compare>::size_type
+btree_multiset<T, Compare>::insert_many(Args&&... args) {
+  (insert(std::forward<Args>(args)), ...);
+  return sizeof...(args);
+}
+
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::size_type
+btree_multiset<T, Compare>::count(const T& key) const {
+  return tree_.Count(key);
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::find(const T& key) const {
+  return tree_.Find(key);
+}
+template <typename T, typename Compare>
+bool btree_multiset<T, Compare>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::lower_bound(const T& key) const {
+  return tree_.LowerBound(key);
+}
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::iterator
+btree_multiset<T, Compare>::upper_bound(const T& key) const {
+  return tree_.UpperBound(key);
+}
+template <typename T, typename Compare>
+std::pair<typename btree_multiset<T, Compare>::iterator,
+          typename btree_multiset<T, Compare>::iterator>
+btree_multiset<T, Compare>::equal_range(const T& key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename T, typename Compare>
+typename btree_multiset<T, Compare>::key_compare
+btree_multiset<T, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const typename btree_multiset<T, Compare>::tree_type&
+btree_multiset<T, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
@@ -0,0 +1,61 @@
+#ifndef SRC_BTREE_NODE_H_
+#define SRC_BTREE_NODE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace s21 {
+// B-tree node: up to kSlots sorted elements in one contiguous array and,
+// for internal nodes, kSlots + 1 children after it. The slots are sized so
+// that a leaf of small elements fills kNodeBytes, i.e. four cache lines,
+// and nodes start on a cache line. Leaves are allocated without the child
+// array. Elements are constructed in place and relocated by move.
+template <typename T>
+struct BTreeNode {
+  static constexpr size_t kCacheLine = 64;
+  static constexpr size_t kNodeBytes = 4 * kCacheLine;
+  static constexpr size_t kHeader = 2 * sizeof(void*);
+  static constexpr int kSlots = static_cast<int>(std::clamp<size_t>(
+      (kNodeBytes - kHeader) / sizeof(T), 3, 255));
+  // Every node off the rightmost path keeps at least kMinSlots elements
+  static constexpr int kMinSlots = (kSlots - 1) / 2;
+
+  BTreeNode* parent;
+  // Index of this node among its parent's children
+  uint8_t position;
+  uint8_t count;
+  bool leaf;
+  alignas(T) unsigned char slots[kSlots * sizeof(T)];
+  BTreeNode* children[kSlots + 1];
+
+  T& Slot(int i) { return reinterpret_cast<T*>(slots)[i]; }
+  const T& Slot(int i) const { return reinterpret_cast<const T*>(slots)[i]; }
+  BTreeNode* Child(int i) const { return children[i]; }
+  void SetChild(int i, BTreeNode* child) {
+    children[i] = child;
+    child->parent = this;
+    child->position = static_cast<uint8_t>(i);
+  }
+
+  static BTreeNode* New(bool is_leaf) {
+    void* raw = ::operator new(Bytes(is_leaf), std::align_val_t(kCacheLine));
+    BTreeNode* node = static_cast<BTreeNode*>(raw);
+    node->parent = nullptr;
+    node->position = 0;
+    node->count = 0;
+    node->leaf = is_leaf;
+    return node;
+  }
+  // The elements must have been destroyed already
+  static void Delete(BTreeNode* node) {
+    ::operator delete(node, std::align_val_t(kCacheLine));
+  }
+  static size_t Bytes(bool is_leaf) {
+    return is_leaf ? offsetof(BTreeNode, children) : sizeof(BTreeNode);
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_BTREE_NODE_H_
@@ -0,0 +1,95 @@
+#ifndef AVL_BTREE_SET_H_
+#define AVL_BTREE_SET_H_
+
+#include <initializer_list>
+#include <limits>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_btree.tpp"
+
+namespace s21 {
+// set on a B-tree: same interface as s21::set, minus node handles, set
+// algebra and order statistics. Lookups cost one cache-friendly node per
+// level instead of one miss per AVL level. Unlike s21::set, any insert or
+// erase invalidates all iterators.
+template <typename T, typename Compare = std::less<T>>
+class btree_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using tree_type = BTree<T, Compare>;
+  // Elements are keys, so they are never handed out for writing
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  btree_set() = default;
+  explicit btree_set(const Compare& comp);
+  btree_set(std::initializer_list<value_type> const& items);
+  // O(n) for sorted input: every element is appended to the last leaf
+  template <typename InputIt>
+  btree_set(InputIt first, InputIt last);
+  btree_set(const btree_set& s) = default;
+  btree_set(btree_set&& s) = default;
+  btree_set& operator=(const btree_set& s) = default;
+  btree_set& operator=(btree_set&& s) = default;
+  ~btree_set() = default;
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const T& value);
+  std::pair<iterator, bool> insert(T&& value);
+  // Amortized O(1) when value belongs right next to hint
+  iterator insert(iterator hint, const T& value);
+  iterator insert(iterator hint, T&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(btree_set& other);
+  // Moves every element of other over, other ends empty
+  void merge(btree_set& other);
+  // Iterators would not survive the later inserts: returns whether each
+  // argument was inserted
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with lo <= key < hi
+  IteratorRange<iterator> range(const T& lo, const T& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_BTREE_SET_H_
@@ -0,0 +1,178 @@
+#include "s21_btree_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+btree_set<T, Compare>::btree_set(const Compare& comp) : tree_(comp) {}
+template <typename T, typename Compare>
+btree_set<T, Compare>::btree_set(
+    std::initializer_list<value_type> const& items)
+    : btree_set(items.begin(), items.end()) {}
+template <typename T, typename Compare>
+template <typename InputIt>
+btree_set<T, Compare>::btree_set(InputIt first, InputIt last) : tree_() {
+  for (; first != last; ++first) tree_.InsertUnique(*first);
+}
+
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::begin()
+    const {
+  return tree_.Begin();
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::end() const {
+  return tree_.End();
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::reverse_iterator
+btree_set<T, Compare>::rbegin() const {
+  return reverse_iterator(end());
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::reverse_iterator btree_set<T, Compare>::rend()
+    const {
+  return reverse_iterator(begin());
+}
+
+template <typename T, typename Compare>
+bool btree_set<T, Compare>::empty() const {
+  return tree_.Size() == 0;
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::size_type btree_set<T, Compare>::size()
+    const {
+  return tree_.Size();
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::size_type btree_set<T, Compare>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename Compare>
+void btree_set<T, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename Compare>
+std::pair<typename btree_set<T, Compare>::iterator, bool>
+btree_set<T, Compare>::insert(const T& value) {
+  return tree_.InsertUnique(value);
+}
+template <typename T, typename Compare>
+std::pair<typename btree_set<T, Compare>::iterator, bool>
+btree_set<T, Compare>::insert(T&& value) {
+  return tree_.InsertUnique(std::move(value));
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::insert(
+    iterator hint, const T& value) {
+  return tree_.InsertHintUnique({hint.node(), hint.position()}, value);
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::insert(
+    iterator hint, T&& value) {
+  return tree_.InsertHintUnique({hint.node(), hint.position()},
+                                std::move(value));
+}
+template <typename T, typename Compare>
+template <typename... Args>
+std::pair<typename btree_set<T, Compare>::iterator, bool>
+btree_set<T, Compare>::emplace(Args&&... args) {
+  return tree_.InsertUnique(T(std::forward<Args>(args)...));
+}
+template <typename T, typename Compare>
+template <typename... Args>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::emplace_hint(
+    iterator hint, Args&&... args) {
+  return insert(hint, T(std::forward<Args>(args)...));
+}
+template <typename T, typename Compare>
+void btree_set<T, Compare>::erase(iterator pos) {
+  tree_.Erase({pos.node(), pos.position()});
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::size_type btree_set<T, Compare>::erase(
+    const T& key) {
+  return tree_.EraseUnique(key);
+}
+template <typename T, typename Compare>
+void btree_set<T, Compare>::swap(btree_set& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename Compare>
+void btree_set<T, Compare>::merge(btree_set& other) {
+  if (this == &other) return;
+  for (auto it = other.tree_.Begin(); it != other.tree_.End(); ++it) {
+    tree_.InsertUnique(std::move(*it));
+  }
+  other.clear();
+}
+template <typename T, typename Compare>
+template <typename... Args>
+s21::vector<bool> btree_set<T, Compare>::insert_many(Args&&... args) {
+  s21::vector<bool> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(insert(std::forward<Args>(args)).second), ...);
+  return result;
+}
+
+template <typename T, typename Compare>
+bool btree_set<T, Compare>::contains(const T& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::find(
+    const T& key) const {
+  return tree_.Find(key);
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::lower_bound(
+    const T& key) const {
+  return tree_.LowerBound(key);
+}
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::upper_bound(
+    const T& key) const {
+  return tree_.UpperBound(key);
+}
+template <typename T, typename Compare>
+std::pair<typename btree_set<T, Compare>::iterator,
+          typename btree_set<T, Compare>::iterator>
+btree_set<T, Compare>::equal_range(const T& key) const {
+  iterator first = lower_bound(key);
+  if (first == end() || tree_.GetCompare()(key, *first)) {
+    return std::make_pair(first, first);
+  }
+  iterator last = first;
+  return std::make_pair(first, ++last);
+}
+template <typename T, typename Compare>
+IteratorRange<typename btree_set<T, Compare>::iterator>
+btree_set<T, Compare>::range(const T& lo, const T& hi) const {
+  iterator first = lower_bound(lo);
+  iterator last = lower_bound(hi);
+  if (!tree_.GetCompare()(lo, hi)) last = first;
+  return IteratorRange<iterator>(first, last);
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+bool btree_set<T, Compare>::contains(const K& key) const {
+  return tree_.Find(key) != tree_.End();
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+typename btree_set<T, Compare>::iterator btree_set<T, Compare>::find(
+    const K& key) const {
+  return tree_.Find(key);
+}
+
+template <typename T, typename Compare>
+typename btree_set<T, Compare>::key_compare btree_set<T, Compare>::key_comp()
+    const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const typename btree_set<T, Compare>::tree_type&
+btree_set<T, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
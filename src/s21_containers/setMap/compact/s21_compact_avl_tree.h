@@ -0,0 +1,99 @@
+#ifndef SRC_COMPACT_AVL_H_
+#define SRC_COMPACT_AVL_H_
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#include "../avlTree/s21_avl_tree.h"
+
+namespace s21 {
+// AVL tree whose nodes live in one contiguous buffer and refer to each other
+// by 32-bit slot index. A node costs 20 bytes of links (three indices, a
+// 32-bit subtree size and a one-byte height) plus the key, against roughly
+// 48 bytes of overhead in Node. Indices stay valid when the buffer grows.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
+class CompactAVLTree {
+ public:
+  using index_type = uint32_t;
+  static constexpr index_type kNil = std::numeric_limits<index_type>::max();
+
+  CompactAVLTree();
+  explicit CompactAVLTree(const Compare& comp);
+  CompactAVLTree(const CompactAVLTree& other);
+  CompactAVLTree(CompactAVLTree&& other) noexcept;
+  ~CompactAVLTree();
+  CompactAVLTree& operator=(CompactAVLTree&& other) noexcept;
+
+  index_type Insert(const T& value);
+  index_type Insert(T&& value);
+  template <typename K>
+  index_type Search(const K& key) const;
+  template <typename K>
+  void Remove(const K& key);
+  void Remove(index_type node);
+  void Clear();
+  void Swap(CompactAVLTree& other) noexcept;
+  bool GetInserted() const;
+
+  index_type GetRoot() const;
+  size_t Size() const;
+  size_t Capacity() const;
+  T& Key(index_type node) const;
+  index_type First() const;
+  index_type Last() const;
+  index_type Next(index_type node) const;
+  index_type Prev(index_type node) const;
+  template <typename K>
+  size_t CountLess(const K& key) const;
+  index_type Select(size_t k) const;
+  const Compare& GetCompare() const;
+
+ private:
+  struct Links {
+    index_type left;
+    index_type right;
+    index_type parent;
+    index_type size;
+    int8_t height;
+  };
+  // height == 0 marks a free slot; free slots are chained through left
+  struct Slot {
+    Links links;
+    alignas(T) unsigned char key[sizeof(T)];
+  };
+
+  Slot* slots_;
+  index_type capacity_;
+  index_type used_;
+  index_type free_;
+  index_type root_;
+  bool inserted_;
+  Compare comp_;
+  KeyOfValue key_of_;
+
+  Links& L(index_type node) const { return slots_[node].links; }
+  index_type SizeOf(index_type node) const;
+  int HeightOf(index_type node) const;
+  int BalanceFactor(index_type node) const;
+  void Update(index_type node);
+  void ReplaceChild(index_type parent, index_type old_child,
+                    index_type new_child);
+  index_type RotateLeft(index_type node);
+  index_type RotateRight(index_type node);
+  index_type Balance(index_type node);
+  void Rebalance(index_type node);
+  index_type Link(index_type node, index_type parent, bool to_left);
+  template <typename U>
+  index_type InsertUnique(U&& value);
+  template <typename U>
+  index_type NewNode(U&& value);
+  void DeleteNode(index_type node);
+  void Grow();
+  void DestroyAll();
+};
+}  // namespace s21
+
+#endif  // SRC_COMPACT_AVL_H_
@@ -0,0 +1,417 @@
+#include "s21_compact_avl_tree.h"
+namespace s21 {
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>::CompactAVLTree()
+    : CompactAVLTree(Compare()) {}
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>::CompactAVLTree(const Compare& comp)
+    : slots_(nullptr),
+      capacity_(0),
+      used_(0),
+      free_(kNil),
+      root_(kNil),
+      inserted_(false),
+      comp_(comp),
+      key_of_() {}
+// Slots are copied index for index, so the copy needs no rebalancing
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>::CompactAVLTree(
+    const CompactAVLTree& other)
+    : CompactAVLTree(other.comp_) {
+  if (other.used_ == 0) return;
+  slots_ = static_cast<Slot*>(::operator new(other.used_ * sizeof(Slot)));
+  capacity_ = other.used_;
+  for (; used_ < other.used_; ++used_) {
+    L(used_) = other.L(used_);
+    if (L(used_).height != 0) {
+      try {
+        new (slots_[used_].key) T(other.Key(used_));
+      } catch (...) {
+        L(used_).height = 0;
+        DestroyAll();
+        throw;
+      }
+    }
+  }
+  free_ = other.free_;
+  root_ = other.root_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>::CompactAVLTree(
+    CompactAVLTree&& other) noexcept
+    : CompactAVLTree(other.comp_) {
+  Swap(other);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>::~CompactAVLTree() {
+  DestroyAll();
+}
+template <typename T, typename Compare, typename KeyOfValue>
+CompactAVLTree<T, Compare, KeyOfValue>&
+CompactAVLTree<T, Compare, KeyOfValue>::operator=(
+    CompactAVLTree&& other) noexcept {
+  if (this != &other) {
+    DestroyAll();
+    Swap(other);
+  }
+  return *this;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::DestroyAll() {
+  if (!std::is_trivially_destructible<T>::value) {
+    for (index_type i = 0; i < used_; ++i) {
+      if (L(i).height != 0) Key(i).~T();
+    }
+  }
+  ::operator delete(slots_);
+  slots_ = nullptr;
+  capacity_ = used_ = 0;
+  free_ = root_ = kNil;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Clear() {
+  DestroyAll();
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Swap(
+    CompactAVLTree& other) noexcept {
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(used_, other.used_);
+  std::swap(free_, other.free_);
+  std::swap(root_, other.root_);
+  std::swap(comp_, other.comp_);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Grow() {
+  index_type capacity = capacity_ ? capacity_ * 2 : 16;
+  if (capacity_ >= kNil / 2) {
+    capacity = kNil;
+  }
+  Slot* slots = static_cast<Slot*>(::operator new(capacity * sizeof(Slot)));
+  for (index_type i = 0; i < used_; ++i) {
+    slots[i].links = slots_[i].links;
+    if (slots_[i].links.height != 0) {
+      T& key = Key(i);
+      new (slots[i].key) T(std::move_if_noexcept(key));
+      key.~T();
+    }
+  }
+  ::operator delete(slots_);
+  slots_ = slots;
+  capacity_ = capacity;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::NewNode(U&& value) {
+  index_type node = free_;
+  if (node != kNil) {
+    new (slots_[node].key) T(std::forward<U>(value));
+    free_ = L(node).left;
+  } else {
+    if (used_ == capacity_) {
+      if (capacity_ == kNil) throw std::length_error("CompactAVLTree is full");
+      Grow();
+    }
+    node = used_;
+    new (slots_[node].key) T(std::forward<U>(value));
+    ++used_;
+  }
+  L(node) = Links{kNil, kNil, kNil, 1, 1};
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::DeleteNode(index_type node) {
+  Key(node).~T();
+  L(node).height = 0;
+  L(node).left = free_;
+  free_ = node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::SizeOf(index_type node) const {
+  return node == kNil ? 0 : L(node).size;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+int CompactAVLTree<T, Compare, KeyOfValue>::HeightOf(index_type node) const {
+  return node == kNil ? 0 : L(node).height;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+int CompactAVLTree<T, Compare, KeyOfValue>::BalanceFactor(
+    index_type node) const {
+  return HeightOf(L(node).left) - HeightOf(L(node).right);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Update(index_type node) {
+  int hl = HeightOf(L(node).left);
+  int hr = HeightOf(L(node).right);
+  L(node).height = static_cast<int8_t>((hl > hr ? hl : hr) + 1);
+  L(node).size = 1 + SizeOf(L(node).left) + SizeOf(L(node).right);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::ReplaceChild(
+    index_type parent, index_type old_child, index_type new_child) {
+  if (parent == kNil) {
+    root_ = new_child;
+  } else if (L(parent).left == old_child) {
+    L(parent).left = new_child;
+  } else {
+    L(parent).right = new_child;
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::RotateRight(index_type node) {
+  index_type new_root = L(node).left;
+  L(node).left = L(new_root).right;
+  if (L(new_root).right != kNil) L(L(new_root).right).parent = node;
+  L(new_root).right = node;
+  L(new_root).parent = L(node).parent;
+  ReplaceChild(L(node).parent, node, new_root);
+  L(node).parent = new_root;
+  Update(node);
+  Update(new_root);
+  return new_root;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::RotateLeft(index_type node) {
+  index_type new_root = L(node).right;
+  L(node).right = L(new_root).left;
+  if (L(new_root).left != kNil) L(L(new_root).left).parent = node;
+  L(new_root).left = node;
+  L(new_root).parent = L(node).parent;
+  ReplaceChild(L(node).parent, node, new_root);
+  L(node).parent = new_root;
+  Update(node);
+  Update(new_root);
+  return new_root;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Balance(index_type node) {
+  Update(node);
+  if (BalanceFactor(node) == 2) {
+    if (BalanceFactor(L(node).left) < 0) RotateLeft(L(node).left);
+    node = RotateRight(node);
+  } else if (BalanceFactor(node) == -2) {
+    if (BalanceFactor(L(node).right) > 0) RotateRight(L(node).right);
+    node = RotateLeft(node);
+  }
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Rebalance(index_type node) {
+  while (node != kNil) {
+    node = L(Balance(node)).parent;
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Link(index_type node,
+                                             index_type parent, bool to_left) {
+  L(node).parent = parent;
+  if (parent == kNil) {
+    root_ = node;
+  } else if (to_left) {
+    L(parent).left = node;
+  } else {
+    L(parent).right = node;
+  }
+  Rebalance(parent);
+  inserted_ = true;
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::InsertUnique(U&& value) {
+  index_type parent = kNil;
+  index_type node = root_;
+  index_type candidate = kNil;
+  bool to_left = false;
+  while (node != kNil) {
+    parent = node;
+    to_left = comp_(key_of_(value), key_of_(Key(node)));
+    if (to_left) {
+      node = L(node).left;
+    } else {
+      candidate = node;
+      node = L(node).right;
+    }
+  }
+  if (candidate != kNil && !comp_(key_of_(Key(candidate)), key_of_(value))) {
+    inserted_ = false;
+    return candidate;
+  }
+  // parent stays a valid index when NewNode grows the buffer
+  return Link(NewNode(std::forward<U>(value)), parent, to_left);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Insert(const T& value) {
+  return InsertUnique(value);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Insert(T&& value) {
+  return InsertUnique(std::move(value));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Search(const K& key) const {
+  index_type node = root_;
+  index_type candidate = kNil;
+  while (node != kNil) {
+    if (comp_(key_of_(Key(node)), key)) {
+      node = L(node).right;
+    } else {
+      candidate = node;
+      node = L(node).left;
+    }
+  }
+  if (candidate != kNil && !comp_(key, key_of_(Key(candidate)))) {
+    return candidate;
+  }
+  return kNil;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void CompactAVLTree<T, Compare, KeyOfValue>::Remove(index_type node) {
+  index_type parent = L(node).parent;
+  index_type fix = parent;
+  if (L(node).left != kNil && L(node).right != kNil) {
+    index_type min = L(node).right;
+    while (L(min).left != kNil) min = L(min).left;
+    if (L(min).parent != node) {
+      fix = L(min).parent;
+      L(fix).left = L(min).right;
+      if (L(min).right != kNil) L(L(min).right).parent = fix;
+      L(min).right = L(node).right;
+      L(L(node).right).parent = min;
+    } else {
+      fix = min;
+    }
+    L(min).left = L(node).left;
+    L(L(node).left).parent = min;
+    L(min).parent = parent;
+    ReplaceChild(parent, node, min);
+  } else {
+    index_type child = L(node).left != kNil ? L(node).left : L(node).right;
+    if (child != kNil) L(child).parent = parent;
+    ReplaceChild(parent, node, child);
+  }
+  DeleteNode(node);
+  Rebalance(fix);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+void CompactAVLTree<T, Compare, KeyOfValue>::Remove(const K& key) {
+  index_type node = Search(key);
+  if (node != kNil) Remove(node);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+bool CompactAVLTree<T, Compare, KeyOfValue>::GetInserted() const {
+  return inserted_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::GetRoot() const {
+  return root_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+size_t CompactAVLTree<T, Compare, KeyOfValue>::Size() const {
+  return SizeOf(root_);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+size_t CompactAVLTree<T, Compare, KeyOfValue>::Capacity() const {
+  return capacity_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+T& CompactAVLTree<T, Compare, KeyOfValue>::Key(index_type node) const {
+  return *std::launder(reinterpret_cast<T*>(slots_[node].key));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::First() const {
+  index_type node = root_;
+  while (node != kNil && L(node).left != kNil) node = L(node).left;
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Last() const {
+  index_type node = root_;
+  while (node != kNil && L(node).right != kNil) node = L(node).right;
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Next(index_type node) const {
+  if (node == kNil) return kNil;
+  if (L(node).right != kNil) {
+    node = L(node).right;
+    while (L(node).left != kNil) node = L(node).left;
+    return node;
+  }
+  index_type parent = L(node).parent;
+  while (parent != kNil && node == L(parent).right) {
+    node = parent;
+    parent = L(parent).parent;
+  }
+  return parent;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Prev(index_type node) const {
+  if (node == kNil) return kNil;
+  if (L(node).left != kNil) {
+    node = L(node).left;
+    while (L(node).right != kNil) node = L(node).right;
+    return node;
+  }
+  index_type parent = L(node).parent;
+  while (parent != kNil && node == L(parent).left) {
+    node = parent;
+    parent = L(parent).parent;
+  }
+  return parent;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+size_t CompactAVLTree<T, Compare, KeyOfValue>::CountLess(const K& key) const {
+  size_t count = 0;
+  index_type node = root_;
+  while (node != kNil) {
+    if (comp_(key_of_(Key(node)), key)) {
+      count += SizeOf(L(node).left) + 1;
+      node = L(node).right;
+    } else {
+      node = L(node).left;
+    }
+  }
+  return count;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename CompactAVLTree<T, Compare, KeyOfValue>::index_type
+CompactAVLTree<T, Compare, KeyOfValue>::Select(size_t k) const {
+  index_type node = root_;
+  while (node != kNil) {
+    size_t left = SizeOf(L(node).left);
+    if (k < left) {
+      node = L(node).left;
+    } else if (k > left) {
+      k -= left + 1;
+      node = L(node).right;
+    } else {
+      return node;
+    }
+  }
+  return kNil;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const Compare& CompactAVLTree<T, Compare, KeyOfValue>::GetCompare() const {
+  return comp_;
+}
+}  // namespace s21
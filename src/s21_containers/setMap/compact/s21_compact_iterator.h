@@ -0,0 +1,53 @@
+#ifndef SRC_COMPACT_ITERATOR_H_
+#define SRC_COMPACT_ITERATOR_H_
+
+#include "s21_compact_avl_tree.tpp"
+
+namespace s21 {
+// Bidirectional iterator over a CompactAVLTree; end() is kNil
+template <typename Tree, typename T>
+class CompactIterator {
+ public:
+  using index_type = typename Tree::index_type;
+  using reference = T&;
+  using pointer = T*;
+
+  CompactIterator() : tree_(nullptr), index_(Tree::kNil) {}
+  CompactIterator(const Tree* tree, index_type index)
+      : tree_(tree), index_(index) {}
+
+  reference operator*() const { return tree_->Key(index_); }
+  pointer operator->() const { return &tree_->Key(index_); }
+  CompactIterator& operator++() {
+    index_ = tree_->Next(index_);
+    return *this;
+  }
+  CompactIterator operator++(int) {
+    CompactIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  CompactIterator& operator--() {
+    index_ = index_ == Tree::kNil ? tree_->Last() : tree_->Prev(index_);
+    return *this;
+  }
+  CompactIterator operator--(int) {
+    CompactIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const CompactIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const CompactIterator& other) const {
+    return index_ != other.index_;
+  }
+  index_type GetIndex() const { return index_; }
+
+ private:
+  const Tree* tree_;
+  index_type index_;
+};
+}  // namespace s21
+
+#endif  // SRC_COMPACT_ITERATOR_H_
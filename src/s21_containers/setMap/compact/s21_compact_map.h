@@ -0,0 +1,68 @@
+#ifndef AVL_COMPACT_MAP_H_
+#define AVL_COMPACT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_compact_iterator.h"
+
+namespace s21 {
+// map with the same interface as s21::map, backed by CompactAVLTree
+template <typename T, typename V, typename Compare = std::less<T>>
+class compact_map {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using tree_type =
+      CompactAVLTree<value_type, Compare, SelectFirst<value_type>>;
+  using iterator = CompactIterator<tree_type, value_type>;
+  using const_iterator = CompactIterator<tree_type, const value_type>;
+  using size_type = size_t;
+
+  compact_map();
+  explicit compact_map(const Compare& comp);
+  compact_map(std::initializer_list<value_type> const& items);
+  compact_map(const compact_map& m) = default;
+  compact_map(compact_map&& m) = default;
+  compact_map& operator=(compact_map&& m) = default;
+  ~compact_map() = default;
+
+  mapped_type& at(const T& key);
+  mapped_type& operator[](const T& key);
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& obj);
+  void erase(iterator pos);
+  void swap(compact_map& other);
+  void merge(compact_map& other);
+
+  bool contains(const T& key);
+  iterator find(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_COMPACT_MAP_H_
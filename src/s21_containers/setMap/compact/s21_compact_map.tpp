@@ -0,0 +1,133 @@
+#include "s21_compact_map.h"
+
+namespace s21 {
+template <typename T, typename V, typename Compare>
+compact_map<T, V, Compare>::compact_map() : tree_() {}
+template <typename T, typename V, typename Compare>
+compact_map<T, V, Compare>::compact_map(const Compare& comp) : tree_(comp) {}
+template <typename T, typename V, typename Compare>
+compact_map<T, V, Compare>::compact_map(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  for (auto i = items.begin(); i != items.end(); ++i) {
+    insert(*i);
+  }
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::mapped_type&
+compact_map<T, V, Compare>::at(const T& key) {
+  auto index = tree_.Search(key);
+  if (index == tree_type::kNil) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return tree_.Key(index).second;
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::mapped_type&
+compact_map<T, V, Compare>::operator[](const T& key) {
+  auto index = tree_.Search(key);
+  if (index == tree_type::kNil) {
+    index = tree_.Insert(value_type(key, mapped_type()));
+  }
+  return tree_.Key(index).second;
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::iterator
+compact_map<T, V, Compare>::begin() {
+  return iterator(&tree_, tree_.First());
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::iterator
+compact_map<T, V, Compare>::end() {
+  return iterator(&tree_, tree_type::kNil);
+}
+template <typename T, typename V, typename Compare>
+bool compact_map<T, V, Compare>::empty() {
+  return tree_.Size() == 0;
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::size_type
+compact_map<T, V, Compare>::size() {
+  return tree_.Size();
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::size_type
+compact_map<T, V, Compare>::max_size() {
+  return tree_type::kNil - 1;
+}
+template <typename T, typename V, typename Compare>
+void compact_map<T, V, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename compact_map<T, V, Compare>::iterator, bool>
+compact_map<T, V, Compare>::insert(const value_type& value) {
+  auto index = tree_.Insert(value);
+  return std::make_pair(iterator(&tree_, index), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename compact_map<T, V, Compare>::iterator, bool>
+compact_map<T, V, Compare>::insert(const key_type& key,
+                                   const mapped_type& obj) {
+  return insert(value_type(key, obj));
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename compact_map<T, V, Compare>::iterator, bool>
+compact_map<T, V, Compare>::insert_or_assign(const key_type& key,
+                                             const mapped_type& obj) {
+  auto index = tree_.Search(key);
+  if (index != tree_type::kNil) {
+    tree_.Key(index).second = obj;
+    return std::make_pair(iterator(&tree_, index), false);
+  }
+  return insert(value_type(key, obj));
+}
+template <typename T, typename V, typename Compare>
+void compact_map<T, V, Compare>::erase(iterator pos) {
+  if (pos != end()) {
+    tree_.Remove(pos.GetIndex());
+  }
+}
+template <typename T, typename V, typename Compare>
+void compact_map<T, V, Compare>::swap(compact_map& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+void compact_map<T, V, Compare>::merge(compact_map& other) {
+  if (this != &other) {
+    for (auto i = other.begin(); i != other.end(); ++i) {
+      insert(*i);
+    }
+  }
+}
+template <typename T, typename V, typename Compare>
+bool compact_map<T, V, Compare>::contains(const T& key) {
+  return tree_.Search(key) != tree_type::kNil;
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::iterator
+compact_map<T, V, Compare>::find(const T& key) {
+  return iterator(&tree_, tree_.Search(key));
+}
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+bool compact_map<T, V, Compare>::contains(const K& key) {
+  return tree_.Search(key) != tree_type::kNil;
+}
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+typename compact_map<T, V, Compare>::iterator
+compact_map<T, V, Compare>::find(const K& key) {
+  return iterator(&tree_, tree_.Search(key));
+}
+template <typename T, typename V, typename Compare>
+typename compact_map<T, V, Compare>::key_compare
+compact_map<T, V, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename V, typename Compare>
+const typename compact_map<T, V, Compare>::tree_type&
+compact_map<T, V, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
@@ -0,0 +1,65 @@
+#ifndef AVL_COMPACT_SET_H_
+#define AVL_COMPACT_SET_H_
+
+#include <initializer_list>
+#include <memory>
+
+#include "s21_compact_iterator.h"
+
+namespace s21 {
+// set with the same interface as s21::set, backed by CompactAVLTree
+template <typename T, typename Compare = std::less<T>>
+class compact_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using tree_type = CompactAVLTree<T, Compare>;
+  using iterator = CompactIterator<tree_type, T>;
+  using const_iterator = CompactIterator<tree_type, const T>;
+  using size_type = size_t;
+
+  compact_set();
+  explicit compact_set(const Compare& comp);
+  compact_set(std::initializer_list<value_type> const& items);
+  compact_set(const compact_set& s) = default;
+  compact_set(compact_set&& s) = default;
+  compact_set& operator=(compact_set&& s) = default;
+  ~compact_set() = default;
+
+  iterator begin();
+  iterator end();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  std::pair<iterator, bool> insert(const T& value);
+  void erase(iterator pos);
+  void swap(compact_set& other);
+  void merge(compact_set& other);
+
+  bool contains(const T& key);
+  iterator find(const T& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+
+  size_type rank(const T& key);
+  iterator select(size_type k);
+  iterator nth(size_type k);
+  size_type count_less(const T& key);
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_COMPACT_SET_H_
@@ -0,0 +1,120 @@
+#include "s21_compact_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+compact_set<T, Compare>::compact_set() : tree_() {}
+template <typename T, typename Compare>
+compact_set<T, Compare>::compact_set(const Compare& comp) : tree_(comp) {}
+template <typename T, typename Compare>
+compact_set<T, Compare>::compact_set(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  for (auto i = items.begin(); i != items.end(); ++i) {
+    insert(*i);
+  }
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::begin() {
+  return iterator(&tree_, tree_.First());
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::end() {
+  return iterator(&tree_, tree_type::kNil);
+}
+template <typename T, typename Compare>
+bool compact_set<T, Compare>::empty() {
+  return tree_.Size() == 0;
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::size_type compact_set<T, Compare>::size() {
+  return tree_.Size();
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::size_type
+compact_set<T, Compare>::max_size() {
+  return tree_type::kNil - 1;
+}
+template <typename T, typename Compare>
+void compact_set<T, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename Compare>
+std::pair<typename compact_set<T, Compare>::iterator, bool>
+compact_set<T, Compare>::insert(const T& value) {
+  auto index = tree_.Insert(value);
+  return std::pair<iterator, bool>(iterator(&tree_, index),
+                                   tree_.GetInserted());
+}
+template <typename T, typename Compare>
+void compact_set<T, Compare>::erase(iterator pos) {
+  if (pos != end()) {
+    tree_.Remove(pos.GetIndex());
+  }
+}
+template <typename T, typename Compare>
+void compact_set<T, Compare>::swap(compact_set& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename Compare>
+void compact_set<T, Compare>::merge(compact_set& other) {
+  if (this != &other) {
+    for (auto i = other.begin(); i != other.end(); ++i) {
+      insert(*i);
+    }
+    other.clear();
+  }
+}
+template <typename T, typename Compare>
+bool compact_set<T, Compare>::contains(const T& key) {
+  return tree_.Search(key) != tree_type::kNil;
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::find(
+    const T& key) {
+  return iterator(&tree_, tree_.Search(key));
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+bool compact_set<T, Compare>::contains(const K& key) {
+  return tree_.Search(key) != tree_type::kNil;
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::find(
+    const K& key) {
+  return iterator(&tree_, tree_.Search(key));
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::size_type compact_set<T, Compare>::rank(
+    const T& key) {
+  if (!contains(key)) {
+    return size();
+  }
+  return tree_.CountLess(key);
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::select(
+    size_type k) {
+  return iterator(&tree_, tree_.Select(k));
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::iterator compact_set<T, Compare>::nth(
+    size_type k) {
+  return select(k);
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::size_type
+compact_set<T, Compare>::count_less(const T& key) {
+  return tree_.CountLess(key);
+}
+template <typename T, typename Compare>
+typename compact_set<T, Compare>::key_compare
+compact_set<T, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const typename compact_set<T, Compare>::tree_type&
+compact_set<T, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
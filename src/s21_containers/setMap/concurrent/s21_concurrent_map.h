@@ -0,0 +1,98 @@
+#ifndef AVL_CONCURRENT_MAP_H_
+#define AVL_CONCURRENT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../map/s21_map.tpp"
+
+namespace s21 {
+// Ordered map safe to share between threads. Keys are spread over a fixed
+// number of shards by hash; each shard is an s21::map behind its own
+// reader-writer lock, so lookups run in parallel and writers only contend
+// when they hit the same shard. Values are returned by copy, as a
+// reference would outlive the lock. Operations on many keys lock each
+// shard once, and ordered walks merge the shards under shared locks.
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Hash = std::hash<K>>
+class concurrent_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using size_type = size_t;
+
+  // Defaults to four shards per hardware thread
+  explicit concurrent_map(size_type shards = 0);
+  // Every shard orders its keys with a copy of comp
+  concurrent_map(size_type shards, const Compare& comp);
+  concurrent_map(std::initializer_list<value_type> const& items);
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  ~concurrent_map() = default;
+
+  size_type shard_count() const;
+  bool empty() const;
+  // Sum over the shards, each read under its own lock
+  size_type size() const;
+  void clear();
+
+  bool insert(const key_type& key, const mapped_type& obj);
+  // Returns whether the key was new
+  bool insert_or_assign(const key_type& key, const mapped_type& obj);
+  size_type erase(const key_type& key);
+  bool contains(const key_type& key) const;
+  std::optional<mapped_type> find(const key_type& key) const;
+  // Runs f(mapped_type&) under the shard's write lock; false when absent
+  template <typename F>
+  bool update(const key_type& key, F f);
+
+  // Batched operations: keys are grouped by shard and every shard lock is
+  // taken once. Results come back in input order.
+  size_type insert_many(const std::vector<value_type>& items);
+  size_type erase_many(const std::vector<key_type>& keys);
+  std::vector<std::optional<mapped_type>> find_many(
+      const std::vector<key_type>& keys) const;
+
+  // Calls f(const value_type&) in key order over a consistent view: all
+  // shards are read-locked, in index order, for the whole walk
+  template <typename F>
+  void for_each(F f) const;
+
+ private:
+  // Own cache lines, so that locking one shard does not slow its neighbours
+  struct alignas(64) Shard {
+    explicit Shard(const Compare& comp) : data(comp) {}
+    mutable std::shared_mutex mutex;
+    // Only lookups run under a shared lock and they do not modify the map
+    mutable map<K, V, Compare> data;
+  };
+  // Shards are built in place from comp_, so Compare need not be default
+  // constructible
+  struct ShardDeleter {
+    // Shards constructed so far, out of the allocated ones
+    size_type built = 0;
+    size_type allocated = 0;
+    void operator()(Shard* shards) const;
+  };
+
+  std::unique_ptr<Shard[], ShardDeleter> shards_;
+  size_type count_;
+  Hash hash_;
+  Compare comp_;
+
+  size_type ShardOf(const key_type& key) const;
+  template <typename Key>
+  std::vector<std::vector<size_type>> GroupByShard(
+      const std::vector<Key>& keys) const;
+};
+}  // namespace s21
+
+#endif  // AVL_CONCURRENT_MAP_H_
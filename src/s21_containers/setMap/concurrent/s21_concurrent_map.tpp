@@ -0,0 +1,232 @@
+#include "s21_concurrent_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename Compare, typename Hash>
+concurrent_map<K, V, Compare, Hash>::concurrent_map(size_type shards)
+    : concurrent_map(shards, Compare()) {}
+template <typename K, typename V, typename Compare, typename Hash>
+concurrent_map<K, V, Compare, Hash>::concurrent_map(size_type shards,
+                                                    const Compare& comp)
+    : shards_(), count_(shards), hash_(), comp_(comp) {
+  if (count_ == 0) {
+    count_ = std::max<size_type>(1, std::thread::hardware_concurrency()) * 4;
+  }
+  Shard* place = std::allocator<Shard>().allocate(count_);
+  ShardDeleter deleter{0, count_};
+  try {
+    for (; deleter.built < count_; deleter.built++) {
+      new (place + deleter.built) Shard(comp_);
+    }
+  } catch (...) {
+    deleter(place);
+    throw;
+  }
+  shards_ = std::unique_ptr<Shard[], ShardDeleter>(place, deleter);
+}
+template <typename K, typename V, typename Compare, typename Hash>
+concurrent_map<K, V, Compare, Hash>::concurrent_map(
+    std::initializer_list<value_type> const& items)
+    : concurrent_map() {
+  insert_many(std::vector<value_type>(items));
+}
+
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::shard_count() const {
+  return count_;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+bool concurrent_map<K, V, Compare, Hash>::empty() const {
+  return size() == 0;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::size() const {
+  size_type total = 0;
+  for (size_type i = 0; i < count_; i++) {
+    std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+    total += shards_[i].data.size();
+  }
+  return total;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+void concurrent_map<K, V, Compare, Hash>::clear() {
+  for (size_type i = 0; i < count_; i++) {
+    std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+    shards_[i].data.clear();
+  }
+}
+
+template <typename K, typename V, typename Compare, typename Hash>
+bool concurrent_map<K, V, Compare, Hash>::insert(const key_type& key,
+                                                 const mapped_type& obj) {
+  Shard& shard = shards_[ShardOf(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.data.try_emplace(key, obj).second;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+bool concurrent_map<K, V, Compare, Hash>::insert_or_assign(
+    const key_type& key, const mapped_type& obj) {
+  Shard& shard = shards_[ShardOf(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.data.insert_or_assign(key, obj).second;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::erase(const key_type& key) {
+  Shard& shard = shards_[ShardOf(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) {
+    return 0;
+  }
+  shard.data.erase(it);
+  return 1;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+bool concurrent_map<K, V, Compare, Hash>::contains(const key_type& key) const {
+  const Shard& shard = shards_[ShardOf(key)];
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  return shard.data.contains(key);
+}
+template <typename K, typename V, typename Compare, typename Hash>
+std::optional<typename concurrent_map<K, V, Compare, Hash>::mapped_type>
+concurrent_map<K, V, Compare, Hash>::find(const key_type& key) const {
+  const Shard& shard = shards_[ShardOf(key)];
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+template <typename F>
+bool concurrent_map<K, V, Compare, Hash>::update(const key_type& key, F f) {
+  Shard& shard = shards_[ShardOf(key)];
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.data.find(key);
+  if (it == shard.data.end()) {
+    return false;
+  }
+  f(it->second);
+  return true;
+}
+
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::insert_many(
+    const std::vector<value_type>& items) {
+  size_type inserted = 0;
+  auto groups = GroupByShard(items);
+  for (size_type i = 0; i < count_; i++) {
+    if (groups[i].empty()) continue;
+    std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+    for (size_type index : groups[i]) {
+      const value_type& item = items[index];
+      inserted += shards_[i].data.try_emplace(item.first, item.second).second;
+    }
+  }
+  return inserted;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::erase_many(
+    const std::vector<key_type>& keys) {
+  size_type erased = 0;
+  auto groups = GroupByShard(keys);
+  for (size_type i = 0; i < count_; i++) {
+    if (groups[i].empty()) continue;
+    std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+    for (size_type index : groups[i]) {
+      auto it = shards_[i].data.find(keys[index]);
+      if (it != shards_[i].data.end()) {
+        shards_[i].data.erase(it);
+        erased++;
+      }
+    }
+  }
+  return erased;
+}
+template <typename K, typename V, typename Compare, typename Hash>
+std::vector<std::optional<typename concurrent_map<K, V, Compare, Hash>::
+                              mapped_type>>
+concurrent_map<K, V, Compare, Hash>::find_many(
+    const std::vector<key_type>& keys) const {
+  std::vector<std::optional<mapped_type>> result(keys.size());
+  auto groups = GroupByShard(keys);
+  for (size_type i = 0; i < count_; i++) {
+    if (groups[i].empty()) continue;
+    std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+    for (size_type index : groups[i]) {
+      auto it = shards_[i].data.find(keys[index]);
+      if (it != shards_[i].data.end()) result[index] = it->second;
+    }
+  }
+  return result;
+}
+// k-way merge of the shards' in-order walks through a binary heap:
+// O(n log s) for n elements in s shards
+template <typename K, typename V, typename Compare, typename Hash>
+template <typename F>
+void concurrent_map<K, V, Compare, Hash>::for_each(F f) const {
+  using iterator = typename map<K, V, Compare>::iterator;
+  std::vector<std::shared_lock<std::shared_mutex>> locks;
+  locks.reserve(count_);
+  std::vector<std::pair<iterator, iterator>> heads;
+  for (size_type i = 0; i < count_; i++) {
+    locks.emplace_back(shards_[i].mutex);
+    if (!shards_[i].data.empty()) {
+      heads.emplace_back(shards_[i].data.begin(), shards_[i].data.end());
+    }
+  }
+  auto later = [this](const std::pair<iterator, iterator>& a,
+                      const std::pair<iterator, iterator>& b) {
+    return comp_(b.first->first, a.first->first);
+  };
+  std::make_heap(heads.begin(), heads.end(), later);
+  while (!heads.empty()) {
+    std::pop_heap(heads.begin(), heads.end(), later);
+    auto& head = heads.back();
+    f(static_cast<const value_type&>(*head.first));
+    if (++head.first == head.second) {
+      heads.pop_back();
+    } else {
+      std::push_heap(heads.begin(), heads.end(), later);
+    }
+  }
+}
+
+template <typename K, typename V, typename Compare, typename Hash>
+typename concurrent_map<K, V, Compare, Hash>::size_type
+concurrent_map<K, V, Compare, Hash>::ShardOf(const key_type& key) const {
+  // std::hash is the identity for integers; mix so that strided keys
+  // still spread over all shards. The multiply moves the entropy up and
+  // the fold brings it back down, for any width of size_t.
+  size_t h = hash_(key) * size_t(0x9E3779B97F4A7C15ull);
+  return (h ^ (h >> (sizeof(size_t) * 4))) % count_;
+}
+// Destroys the shards built, then frees the storage of all of them
+template <typename K, typename V, typename Compare, typename Hash>
+void concurrent_map<K, V, Compare, Hash>::ShardDeleter::operator()(
+    Shard* shards) const {
+  for (size_type i = 0; i < built; i++) shards[i].~Shard();
+  std::allocator<Shard>().deallocate(shards, allocated);
+}
+template <typename K, typename V, typename Compare, typename Hash>
+template <typename Key>
+std::vector<
+    std::vector<typename concurrent_map<K, V, Compare, Hash>::size_type>>
+concurrent_map<K, V, Compare, Hash>::GroupByShard(
+    const std::vector<Key>& keys) const {
+  std::vector<std::vector<size_type>> groups(count_);
+  for (size_type i = 0; i < keys.size(); i++) {
+    if constexpr (std::is_same<Key, value_type>::value) {
+      groups[ShardOf(keys[i].first)].push_back(i);
+    } else {
+      groups[ShardOf(keys[i])].push_back(i);
+    }
+  }
+  return groups;
+}
+}  // namespace s21
@@ -0,0 +1,59 @@
+#ifndef AVL_CONCURRENT_SET_H_
+#define AVL_CONCURRENT_SET_H_
+
+#include <initializer_list>
+
+#include "s21_skip_list_iterator.h"
+
+namespace s21 {
+// Ordered set that any number of threads may read and update at once
+// without locks, built on LockFreeSkipList. Every operation is O(log n)
+// expected. Elements are immutable; iteration is weakly consistent: it
+// sees what was present for the whole walk and may or may not see
+// concurrent changes. size() is exact only while no update is running.
+// insert returns just a bool, as an iterator would pin the epoch.
+template <typename T, typename Compare = std::less<T>>
+class concurrent_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using list_type = LockFreeSkipList<T, Compare>;
+  using iterator = SkipListIterator<list_type, T>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  concurrent_set() = default;
+  explicit concurrent_set(const Compare& comp);
+  concurrent_set(std::initializer_list<value_type> const& items);
+  concurrent_set(const concurrent_set&) = delete;
+  concurrent_set& operator=(const concurrent_set&) = delete;
+  ~concurrent_set() = default;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+
+  // Erases element by element: not atomic against concurrent inserts
+  void clear();
+  bool insert(const T& value);
+  bool insert(T&& value);
+  size_type erase(const T& key);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+
+  key_compare key_comp() const;
+  const list_type& get_list() const;
+
+ private:
+  list_type list_;
+};
+}  // namespace s21
+
+#endif  // AVL_CONCURRENT_SET_H_
@@ -0,0 +1,84 @@
+#include "s21_concurrent_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+concurrent_set<T, Compare>::concurrent_set(const Compare& comp)
+    : list_(comp) {}
+template <typename T, typename Compare>
+concurrent_set<T, Compare>::concurrent_set(
+    std::initializer_list<value_type> const& items)
+    : list_() {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::iterator
+concurrent_set<T, Compare>::begin() const {
+  auto guard = list_.Pin();
+  auto* node = list_.First(guard);
+  return iterator(std::move(guard), node);
+}
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::iterator concurrent_set<T, Compare>::end()
+    const {
+  return iterator();
+}
+
+template <typename T, typename Compare>
+bool concurrent_set<T, Compare>::empty() const {
+  return begin() == end();
+}
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::size_type
+concurrent_set<T, Compare>::size() const {
+  return list_.Size();
+}
+
+template <typename T, typename Compare>
+void concurrent_set<T, Compare>::clear() {
+  list_.Clear();
+}
+template <typename T, typename Compare>
+bool concurrent_set<T, Compare>::insert(const T& value) {
+  return list_.Insert(value);
+}
+template <typename T, typename Compare>
+bool concurrent_set<T, Compare>::insert(T&& value) {
+  return list_.Insert(std::move(value));
+}
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::size_type
+concurrent_set<T, Compare>::erase(const T& key) {
+  return list_.Remove(key) ? 1 : 0;
+}
+
+template <typename T, typename Compare>
+bool concurrent_set<T, Compare>::contains(const T& key) const {
+  return list_.Contains(key);
+}
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::iterator
+concurrent_set<T, Compare>::find(const T& key) const {
+  auto guard = list_.Pin();
+  auto* node = list_.Search(key, guard);
+  return iterator(std::move(guard), node);
+}
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::iterator
+concurrent_set<T, Compare>::lower_bound(const T& key) const {
+  auto guard = list_.Pin();
+  auto* node = list_.LowerBound(key, guard);
+  return iterator(std::move(guard), node);
+}
+
+template <typename T, typename Compare>
+typename concurrent_set<T, Compare>::key_compare
+concurrent_set<T, Compare>::key_comp() const {
+  return list_.GetCompare();
+}
+template <typename T, typename Compare>
+const typename concurrent_set<T, Compare>::list_type&
+concurrent_set<T, Compare>::get_list() const {
+  return list_;
+}
+}  // namespace s21
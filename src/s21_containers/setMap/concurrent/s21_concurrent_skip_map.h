@@ -0,0 +1,61 @@
+#ifndef AVL_CONCURRENT_SKIP_MAP_H_
+#define AVL_CONCURRENT_SKIP_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_skip_list_iterator.h"
+
+namespace s21 {
+// Lock-free ordered map, see concurrent_set. Entries are immutable once
+// inserted, so at() returns a copy and there is no operator[]. For a map
+// whose values change in place, use the lock-based concurrent_map.
+template <typename T, typename V, typename Compare = std::less<T>>
+class concurrent_skip_map {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using key_compare = Compare;
+  using list_type =
+      LockFreeSkipList<value_type, Compare, SelectFirst<value_type>>;
+  using iterator = SkipListIterator<list_type, value_type>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  concurrent_skip_map() = default;
+  explicit concurrent_skip_map(const Compare& comp);
+  concurrent_skip_map(std::initializer_list<value_type> const& items);
+  concurrent_skip_map(const concurrent_skip_map&) = delete;
+  concurrent_skip_map& operator=(const concurrent_skip_map&) = delete;
+  ~concurrent_skip_map() = default;
+
+  mapped_type at(const T& key) const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+
+  // Erases entry by entry: not atomic against concurrent inserts
+  void clear();
+  bool insert(const value_type& value);
+  bool insert(const key_type& key, const mapped_type& obj);
+  size_type erase(const T& key);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+
+  key_compare key_comp() const;
+  const list_type& get_list() const;
+
+ private:
+  list_type list_;
+};
+}  // namespace s21
+
+#endif  // AVL_CONCURRENT_SKIP_MAP_H_
@@ -0,0 +1,96 @@
+#include "s21_concurrent_skip_map.h"
+
+namespace s21 {
+template <typename T, typename V, typename Compare>
+concurrent_skip_map<T, V, Compare>::concurrent_skip_map(const Compare& comp)
+    : list_(comp) {}
+template <typename T, typename V, typename Compare>
+concurrent_skip_map<T, V, Compare>::concurrent_skip_map(
+    std::initializer_list<value_type> const& items)
+    : list_() {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::mapped_type
+concurrent_skip_map<T, V, Compare>::at(const T& key) const {
+  auto guard = list_.Pin();
+  auto* node = list_.Search(key, guard);
+  if (node == nullptr) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return node->value().second;
+}
+
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::iterator
+concurrent_skip_map<T, V, Compare>::begin() const {
+  auto guard = list_.Pin();
+  auto* node = list_.First(guard);
+  return iterator(std::move(guard), node);
+}
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::iterator
+concurrent_skip_map<T, V, Compare>::end() const {
+  return iterator();
+}
+
+template <typename T, typename V, typename Compare>
+bool concurrent_skip_map<T, V, Compare>::empty() const {
+  return begin() == end();
+}
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::size_type
+concurrent_skip_map<T, V, Compare>::size() const {
+  return list_.Size();
+}
+
+template <typename T, typename V, typename Compare>
+void concurrent_skip_map<T, V, Compare>::clear() {
+  list_.Clear();
+}
+template <typename T, typename V, typename Compare>
+bool concurrent_skip_map<T, V, Compare>::insert(const value_type& value) {
+  return list_.Insert(value);
+}
+template <typename T, typename V, typename Compare>
+bool concurrent_skip_map<T, V, Compare>::insert(const key_type& key,
+                                                const mapped_type& obj) {
+  return list_.Insert(value_type(key, obj));
+}
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::size_type
+concurrent_skip_map<T, V, Compare>::erase(const T& key) {
+  return list_.Remove(key) ? 1 : 0;
+}
+
+template <typename T, typename V, typename Compare>
+bool concurrent_skip_map<T, V, Compare>::contains(const T& key) const {
+  return list_.Contains(key);
+}
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::iterator
+concurrent_skip_map<T, V, Compare>::find(const T& key) const {
+  auto guard = list_.Pin();
+  auto* node = list_.Search(key, guard);
+  return iterator(std::move(guard), node);
+}
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::iterator
+concurrent_skip_map<T, V, Compare>::lower_bound(const T& key) const {
+  auto guard = list_.Pin();
+  auto* node = list_.LowerBound(key, guard);
+  return iterator(std::move(guard), node);
+}
+
+template <typename T, typename V, typename Compare>
+typename concurrent_skip_map<T, V, Compare>::key_compare
+concurrent_skip_map<T, V, Compare>::key_comp() const {
+  return list_.GetCompare();
+}
+template <typename T, typename V, typename Compare>
+const typename concurrent_skip_map<T, V, Compare>::list_type&
+concurrent_skip_map<T, V, Compare>::get_list() const {
+  return list_;
+}
+}  // namespace s21
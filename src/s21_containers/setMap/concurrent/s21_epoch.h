@@ -0,0 +1,185 @@
+#ifndef SRC_EPOCH_H_
+#define SRC_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Epoch-based reclamation for lock-free structures. A thread pins the
+// domain for the length of an operation; memory it unlinks is retired
+// rather than freed, and is freed once the global epoch has moved two
+// steps past the retirement, when no pinned thread can still reach it.
+// The epoch only advances when every pinned thread has seen the current
+// one, so a thread that stays pinned holds reclamation back.
+//
+// Pins are slots claimed from a lock-free list, not per-thread records,
+// so pins may nest and move between threads and the domain needs no
+// thread_local state. Retired memory waits in the limbo lists of the
+// slot that retired it and is freed when a later pin of that slot finds
+// it expired, or when the domain is destroyed.
+class EpochDomain {
+ private:
+  struct Record;
+
+ public:
+  using Deleter = void (*)(void*);
+
+  // Keeps the domain pinned while alive; movable, not copyable
+  class Guard {
+   public:
+    Guard() : domain_(nullptr), record_(nullptr) {}
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+    Guard(Guard&& other) noexcept : Guard() { Swap(other); }
+    Guard& operator=(Guard&& other) noexcept {
+      if (this != &other) {
+        Release();
+        Swap(other);
+      }
+      return *this;
+    }
+    ~Guard() { Release(); }
+
+    bool empty() const { return record_ == nullptr; }
+    // A second pin at this guard's epoch: whatever this guard protects
+    // stays protected for as long as the clone lives
+    Guard Clone() const {
+      if (record_ == nullptr) return Guard();
+      return domain_->PinAt(record_->epoch.load(std::memory_order_relaxed));
+    }
+    // ptr must already be unreachable for threads that pin from now on
+    void Retire(void* ptr, Deleter deleter) {
+      domain_->Retire(record_, ptr, deleter);
+    }
+    void Release() {
+      if (record_ != nullptr) domain_->Unpin(record_);
+      domain_ = nullptr;
+      record_ = nullptr;
+    }
+    void Swap(Guard& other) noexcept {
+      std::swap(domain_, other.domain_);
+      std::swap(record_, other.record_);
+    }
+
+   private:
+    friend class EpochDomain;
+    Guard(EpochDomain* domain, Record* record)
+        : domain_(domain), record_(record) {}
+
+    EpochDomain* domain_;
+    Record* record_;
+  };
+
+  EpochDomain() : epoch_(0), records_(nullptr) {}
+  EpochDomain(const EpochDomain&) = delete;
+  EpochDomain& operator=(const EpochDomain&) = delete;
+  // No thread may be pinned any more
+  ~EpochDomain() {
+    Record* record = records_.load(std::memory_order_acquire);
+    while (record != nullptr) {
+      Record* next = record->next;
+      for (auto& limbo : record->limbo) FreeAll(limbo);
+      delete record;
+      record = next;
+    }
+  }
+
+  Guard Pin() { return PinAt(epoch_.load(std::memory_order_seq_cst)); }
+
+ private:
+  struct Retired {
+    void* ptr;
+    Deleter deleter;
+  };
+  static constexpr uint64_t kIdle = std::numeric_limits<uint64_t>::max();
+  // Pending retirements that make an unpin try to advance and collect
+  static constexpr size_t kCollectThreshold = 64;
+
+  struct Record {
+    std::atomic<bool> owned{true};
+    std::atomic<uint64_t> epoch{kIdle};
+    Record* next = nullptr;
+    // Owner only: limbo[e % 3] holds what was retired in epoch_of[e % 3]
+    std::vector<Retired> limbo[3];
+    uint64_t epoch_of[3] = {0, 0, 0};
+    size_t pending = 0;
+  };
+
+  std::atomic<uint64_t> epoch_;
+  std::atomic<Record*> records_;
+
+  // An epoch older than the current one is safe, it only holds the
+  // advance back
+  Guard PinAt(uint64_t epoch) {
+    Record* record = Claim();
+    // The announcement must be visible before any shared pointer is read:
+    // a sequentially consistent exchange is a full barrier
+    record->epoch.exchange(epoch, std::memory_order_seq_cst);
+    return Guard(this, record);
+  }
+  Record* Claim() {
+    Record* head = records_.load(std::memory_order_acquire);
+    for (Record* record = head; record != nullptr; record = record->next) {
+      if (!record->owned.load(std::memory_order_relaxed) &&
+          !record->owned.exchange(true, std::memory_order_acquire)) {
+        return record;
+      }
+    }
+    Record* record = new Record();
+    record->next = head;
+    while (!records_.compare_exchange_weak(record->next, record,
+                                           std::memory_order_release,
+                                           std::memory_order_acquire)) {
+    }
+    return record;
+  }
+  void Unpin(Record* record) {
+    record->epoch.store(kIdle, std::memory_order_release);
+    if (record->pending >= kCollectThreshold) {
+      TryAdvance();
+      Collect(record, epoch_.load(std::memory_order_acquire));
+    }
+    record->owned.store(false, std::memory_order_release);
+  }
+  void Retire(Record* record, void* ptr, Deleter deleter) {
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    std::vector<Retired>& limbo = record->limbo[epoch % 3];
+    if (record->epoch_of[epoch % 3] != epoch) {
+      // Whatever is left there is at least three epochs old
+      record->pending -= limbo.size();
+      FreeAll(limbo);
+      record->epoch_of[epoch % 3] = epoch;
+    }
+    limbo.push_back({ptr, deleter});
+    record->pending++;
+  }
+  // Moves the epoch on if every pinned slot has announced the current one
+  void TryAdvance() {
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    Record* record = records_.load(std::memory_order_acquire);
+    for (; record != nullptr; record = record->next) {
+      uint64_t seen = record->epoch.load(std::memory_order_seq_cst);
+      if (seen != kIdle && seen != epoch) return;
+    }
+    epoch_.compare_exchange_strong(epoch, epoch + 1,
+                                   std::memory_order_seq_cst);
+  }
+  void Collect(Record* record, uint64_t epoch) {
+    for (int i = 0; i < 3; i++) {
+      if (!record->limbo[i].empty() && record->epoch_of[i] + 2 <= epoch) {
+        record->pending -= record->limbo[i].size();
+        FreeAll(record->limbo[i]);
+      }
+    }
+  }
+  static void FreeAll(std::vector<Retired>& limbo) {
+    for (const Retired& retired : limbo) retired.deleter(retired.ptr);
+    limbo.clear();
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_EPOCH_H_
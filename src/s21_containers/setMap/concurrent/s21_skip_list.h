@@ -0,0 +1,108 @@
+#ifndef SRC_SKIP_LIST_H_
+#define SRC_SKIP_LIST_H_
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../avlTree/s21_avl_tree.h"
+#include "s21_epoch.h"
+
+namespace s21 {
+// Lock-free skip list of unique keys (Harris-style marked links, as in
+// Herlihy and Shavit). A node is logically erased once the low bit of its
+// level-0 link is set; searches unlink marked nodes as they pass them.
+// Unlinked nodes are retired to an EpochDomain, so readers never touch
+// freed memory. Elements are immutable once inserted.
+//
+// Insert, Remove and the lookups are lock-free and O(log n) expected.
+// Walking level 0 is weakly consistent: it sees every element present for
+// the whole walk and may or may not see concurrent changes.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
+class LockFreeSkipList {
+ public:
+  using Guard = EpochDomain::Guard;
+  // Enough for 4^16 elements at p = 1/4
+  static constexpr int kMaxHeight = 16;
+
+  // The links follow the node in the same allocation, one per level
+  struct Node {
+    alignas(T) unsigned char storage[sizeof(T)];
+    // Inserter and remover: whichever finishes last retires the node
+    std::atomic<int> owners;
+    int height;
+
+    T& value() { return *reinterpret_cast<T*>(storage); }
+    std::atomic<uintptr_t>* next() {
+      return reinterpret_cast<std::atomic<uintptr_t>*>(
+          reinterpret_cast<char*>(this) + kLinksOffset);
+    }
+  };
+
+  LockFreeSkipList();
+  explicit LockFreeSkipList(const Compare& comp);
+  LockFreeSkipList(const LockFreeSkipList&) = delete;
+  LockFreeSkipList& operator=(const LockFreeSkipList&) = delete;
+  // No other thread may be using the list
+  ~LockFreeSkipList();
+
+  Guard Pin() const;
+
+  template <typename U>
+  bool Insert(U&& value);
+  template <typename K>
+  bool Remove(const K& key);
+  template <typename K>
+  bool Contains(const K& key) const;
+  // The node pointers below stay valid while guard is held
+  template <typename K>
+  Node* Search(const K& key, const Guard& guard) const;
+  template <typename K>
+  Node* LowerBound(const K& key, const Guard& guard) const;
+  Node* First(const Guard& guard) const;
+  // Next element that was not erased when the link was read
+  static Node* Next(Node* node);
+  static bool IsErased(Node* node);
+
+  // Exact when no update is running
+  size_t Size() const;
+  // Erases the elements one by one; not atomic
+  void Clear();
+  const Compare& GetCompare() const;
+  const KeyOfValue& GetKeyOfValue() const;
+
+ private:
+  static constexpr size_t kLinksOffset =
+      (sizeof(Node) + alignof(std::atomic<uintptr_t>) - 1) /
+      alignof(std::atomic<uintptr_t>) * alignof(std::atomic<uintptr_t>);
+
+  mutable EpochDomain domain_;
+  Node* head_;
+  std::atomic<size_t> size_;
+  Compare comp_;
+  KeyOfValue key_of_;
+
+  static Node* Pointer(uintptr_t link);
+  static bool Marked(uintptr_t link);
+  static uintptr_t Link(Node* node, bool marked = false);
+
+  template <typename K>
+  bool Less(Node* node, const K& key) const;
+  // Fills preds/succs with the neighbours of key on every level, unlinking
+  // the marked nodes met on the way; true if succs[0] holds key
+  template <typename K>
+  bool Find(const K& key, Node** preds, Node** succs) const;
+  void Release(Node* node, Guard& guard);
+
+  static int RandomHeight();
+  static Node* NewNode(int height);
+  template <typename U>
+  static Node* NewNode(int height, U&& value);
+  static void DeleteNode(Node* node, bool has_value);
+  static void RetiredDeleter(void* node);
+};
+}  // namespace s21
+
+#endif  // SRC_SKIP_LIST_H_
@@ -0,0 +1,327 @@
+#ifndef SKIP_LIST_TPP
+#define SKIP_LIST_TPP
+#include <new>
+
+#include "s21_skip_list.h"
+namespace s21 {
+template <typename T, typename Compare, typename KeyOfValue>
+LockFreeSkipList<T, Compare, KeyOfValue>::LockFreeSkipList()
+    : LockFreeSkipList(Compare()) {}
+template <typename T, typename Compare, typename KeyOfValue>
+LockFreeSkipList<T, Compare, KeyOfValue>::LockFreeSkipList(
+    const Compare& comp)
+    : domain_(), head_(NewNode(kMaxHeight)), size_(0), comp_(comp) {}
+template <typename T, typename Compare, typename KeyOfValue>
+LockFreeSkipList<T, Compare, KeyOfValue>::~LockFreeSkipList() {
+  Node* node = Pointer(head_->next()[0].load(std::memory_order_relaxed));
+  while (node != nullptr) {
+    Node* next = Pointer(node->next()[0].load(std::memory_order_relaxed));
+    DeleteNode(node, true);
+    node = next;
+  }
+  DeleteNode(head_, false);
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Guard
+LockFreeSkipList<T, Compare, KeyOfValue>::Pin() const {
+  return domain_.Pin();
+}
+
+// Links level 0 first, which is where the element becomes visible, then
+// the upper levels bottom-up, searching again whenever a neighbour moved
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Insert(U&& value) {
+  Guard guard = Pin();
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  int height = RandomHeight();
+  Node* node = nullptr;
+  const T* probe = nullptr;
+  // A T is probed in place until it is moved into the node; anything else
+  // is converted once, straight into the node. Either way the node's copy
+  // is the probe from then on.
+  if constexpr (std::is_same_v<std::decay_t<U>, T>) {
+    probe = &value;
+  } else {
+    node = NewNode(height, std::forward<U>(value));
+    probe = &node->value();
+  }
+  for (;;) {
+    if (Find(key_of_(*probe), preds, succs)) {
+      if (node != nullptr) DeleteNode(node, true);
+      return false;
+    }
+    if (node == nullptr) {
+      node = NewNode(height, std::forward<U>(value));
+      probe = &node->value();
+    }
+    for (int level = 0; level < height; level++) {
+      node->next()[level].store(Link(succs[level]), std::memory_order_relaxed);
+    }
+    uintptr_t expected = Link(succs[0]);
+    if (preds[0]->next()[0].compare_exchange_strong(
+            expected, Link(node), std::memory_order_release,
+            std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+  const auto& key = key_of_(node->value());
+  bool erased = false;
+  for (int level = 1; level < height && !erased; level++) {
+    for (;;) {
+      // Only a remove changes the links of a level not linked yet
+      uintptr_t link = node->next()[level].load(std::memory_order_acquire);
+      if (Marked(link) ||
+          (Pointer(link) != succs[level] &&
+           !node->next()[level].compare_exchange_strong(
+               link, Link(succs[level]), std::memory_order_release,
+               std::memory_order_relaxed))) {
+        erased = true;
+        break;
+      }
+      uintptr_t expected = Link(succs[level]);
+      if (preds[level]->next()[level].compare_exchange_strong(
+              expected, Link(node), std::memory_order_release,
+              std::memory_order_relaxed)) {
+        break;
+      }
+      if (!Find(key, preds, succs) || succs[0] != node) {
+        erased = true;
+        break;
+      }
+    }
+  }
+  // A remove that ran while we were linking may have missed a level
+  if (Marked(node->next()[0].load(std::memory_order_acquire))) {
+    Find(key, preds, succs);
+  }
+  Release(node, guard);
+  return true;
+}
+// Marks the upper levels top-down, then level 0, which is the erase
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Remove(const K& key) {
+  Guard guard = Pin();
+  Node* preds[kMaxHeight];
+  Node* succs[kMaxHeight];
+  if (!Find(key, preds, succs)) return false;
+  Node* node = succs[0];
+  for (int level = node->height - 1; level > 0; level--) {
+    uintptr_t link = node->next()[level].load(std::memory_order_acquire);
+    while (!Marked(link) && !node->next()[level].compare_exchange_weak(
+                                link, link | 1, std::memory_order_acq_rel,
+                                std::memory_order_acquire)) {
+    }
+  }
+  uintptr_t link = node->next()[0].load(std::memory_order_acquire);
+  for (;;) {
+    // Lost to a concurrent remove
+    if (Marked(link)) return false;
+    if (node->next()[0].compare_exchange_weak(link, link | 1,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire)) {
+      break;
+    }
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  Find(key, preds, succs);
+  Release(node, guard);
+  return true;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Contains(const K& key) const {
+  Guard guard = Pin();
+  return Search(key, guard) != nullptr;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::Search(const K& key,
+                                                 const Guard& guard) const {
+  Node* node = LowerBound(key, guard);
+  if (node == nullptr || comp_(key, key_of_(node->value()))) return nullptr;
+  return node;
+}
+// Read-only descent: marked nodes are stepped over, not unlinked
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::LowerBound(const K& key,
+                                                     const Guard&) const {
+  Node* pred = head_;
+  Node* curr = nullptr;
+  for (int level = kMaxHeight - 1; level >= 0; level--) {
+    curr = Pointer(pred->next()[level].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+      if (!Marked(succ)) {
+        if (!Less(curr, key)) break;
+        pred = curr;
+      }
+      curr = Pointer(succ);
+    }
+  }
+  return curr;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::First(const Guard&) const {
+  return Next(head_);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::Next(Node* node) {
+  node = Pointer(node->next()[0].load(std::memory_order_acquire));
+  while (node != nullptr && IsErased(node)) {
+    node = Pointer(node->next()[0].load(std::memory_order_acquire));
+  }
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::IsErased(Node* node) {
+  return Marked(node->next()[0].load(std::memory_order_acquire));
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+size_t LockFreeSkipList<T, Compare, KeyOfValue>::Size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void LockFreeSkipList<T, Compare, KeyOfValue>::Clear() {
+  Guard guard = Pin();
+  for (Node* node = First(guard); node != nullptr; node = Next(node)) {
+    Remove(key_of_(node->value()));
+  }
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const Compare& LockFreeSkipList<T, Compare, KeyOfValue>::GetCompare() const {
+  return comp_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const KeyOfValue& LockFreeSkipList<T, Compare, KeyOfValue>::GetKeyOfValue()
+    const {
+  return key_of_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::Pointer(uintptr_t link) {
+  return reinterpret_cast<Node*>(link & ~uintptr_t(1));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Marked(uintptr_t link) {
+  return (link & 1) != 0;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+uintptr_t LockFreeSkipList<T, Compare, KeyOfValue>::Link(Node* node,
+                                                         bool marked) {
+  return reinterpret_cast<uintptr_t>(node) | uintptr_t(marked);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Less(Node* node,
+                                                    const K& key) const {
+  return comp_(key_of_(node->value()), key);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+bool LockFreeSkipList<T, Compare, KeyOfValue>::Find(const K& key,
+                                                    Node** preds,
+                                                    Node** succs) const {
+  bool retry = true;
+  while (retry) {
+    retry = false;
+    Node* pred = head_;
+    for (int level = kMaxHeight - 1; level >= 0 && !retry; level--) {
+      Node* curr = Pointer(pred->next()[level].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+        if (Marked(succ)) {
+          // Unlink curr here; start over if pred changed meanwhile
+          uintptr_t expected = Link(curr);
+          if (!pred->next()[level].compare_exchange_strong(
+                  expected, Link(Pointer(succ)), std::memory_order_acq_rel,
+                  std::memory_order_relaxed)) {
+            retry = true;
+            break;
+          }
+        } else if (Less(curr, key)) {
+          pred = curr;
+        } else {
+          break;
+        }
+        curr = Pointer(succ);
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+  }
+  return succs[0] != nullptr && !comp_(key, key_of_(succs[0]->value()));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void LockFreeSkipList<T, Compare, KeyOfValue>::Release(Node* node,
+                                                       Guard& guard) {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    guard.Retire(node, RetiredDeleter);
+  }
+}
+
+// Geometric with p = 1/4, from a per-thread xorshift generator
+template <typename T, typename Compare, typename KeyOfValue>
+int LockFreeSkipList<T, Compare, KeyOfValue>::RandomHeight() {
+  thread_local uint64_t state =
+      reinterpret_cast<uintptr_t>(&state) * 0x9E3779B97F4A7C15ull | 1;
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  int height = 1;
+  for (uint64_t bits = state; (bits & 3) == 0 && height < kMaxHeight;
+       bits >>= 2) {
+    height++;
+  }
+  return height;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::NewNode(int height) {
+  void* raw = ::operator new(kLinksOffset +
+                             height * sizeof(std::atomic<uintptr_t>));
+  Node* node = new (raw) Node;
+  node->owners.store(2, std::memory_order_relaxed);
+  node->height = height;
+  for (int level = 0; level < height; level++) {
+    new (&node->next()[level]) std::atomic<uintptr_t>(0);
+  }
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename LockFreeSkipList<T, Compare, KeyOfValue>::Node*
+LockFreeSkipList<T, Compare, KeyOfValue>::NewNode(int height, U&& value) {
+  Node* node = NewNode(height);
+  try {
+    new (node->storage) T(std::forward<U>(value));
+  } catch (...) {
+    DeleteNode(node, false);
+    throw;
+  }
+  return node;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void LockFreeSkipList<T, Compare, KeyOfValue>::DeleteNode(Node* node,
+                                                          bool has_value) {
+  if (has_value) node->value().~T();
+  node->~Node();
+  ::operator delete(node);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void LockFreeSkipList<T, Compare, KeyOfValue>::RetiredDeleter(void* node) {
+  DeleteNode(static_cast<Node*>(node), true);
+}
+}  // namespace s21
+#endif  // SKIP_LIST_TPP
@@ -0,0 +1,65 @@
+#ifndef SRC_SKIP_LIST_ITERATOR_H_
+#define SRC_SKIP_LIST_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+
+#include "s21_skip_list.tpp"
+
+namespace s21 {
+// Forward iterator over a LockFreeSkipList. It keeps the list's epoch
+// pinned, so the element it points at is never freed under it, even once
+// erased; a copy pins again at the same epoch. Walking skips the elements
+// erased by then. Holding iterators for long delays reclamation.
+template <typename List, typename T>
+class SkipListIterator {
+ public:
+  using value_type = T;
+  using reference = const T&;
+  using pointer = const T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+  using Node = typename List::Node;
+  using Guard = typename List::Guard;
+
+  SkipListIterator() : guard_(), node_(nullptr) {}
+  SkipListIterator(Guard guard, Node* node)
+      : guard_(std::move(guard)), node_(node) {
+    if (node_ == nullptr) guard_.Release();
+  }
+  SkipListIterator(const SkipListIterator& other)
+      : guard_(other.guard_.Clone()), node_(other.node_) {}
+  SkipListIterator(SkipListIterator&& other) noexcept = default;
+  SkipListIterator& operator=(SkipListIterator other) noexcept {
+    guard_.Swap(other.guard_);
+    std::swap(node_, other.node_);
+    return *this;
+  }
+  ~SkipListIterator() = default;
+
+  reference operator*() const { return node_->value(); }
+  pointer operator->() const { return &node_->value(); }
+  SkipListIterator& operator++() {
+    node_ = List::Next(node_);
+    if (node_ == nullptr) guard_.Release();
+    return *this;
+  }
+  SkipListIterator operator++(int) {
+    SkipListIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const SkipListIterator& other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const SkipListIterator& other) const {
+    return node_ != other.node_;
+  }
+
+ private:
+  Guard guard_;
+  Node* node_;
+};
+}  // namespace s21
+
+#endif  // SRC_SKIP_LIST_ITERATOR_H_
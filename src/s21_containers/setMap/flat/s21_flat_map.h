@@ -0,0 +1,144 @@
+#ifndef AVL_FLAT_MAP_H_
+#define AVL_FLAT_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_flat_map_iterator.h"
+#include "s21_flat_search.h"
+
+namespace s21 {
+// map as two parallel s21::vectors, sorted keys and their values: same
+// interface as s21::map, minus node handles, set algebra and order
+// statistics. A lookup binary searches the keys alone, so it touches only
+// keys until it has found its slot. As with flat_set, a single insert or
+// erase is O(n) and invalidates all iterators; bulk inserts sort and
+// merge in one pass.
+//
+// Iterators yield std::pair<const K&, V&> by value, see FlatMapIterator.
+// Keys and values must be default constructible and copy assignable:
+// s21::vector allocates its slots with new T[n] and fills them by
+// assignment.
+template <typename K, typename V, typename Compare = std::less<K>>
+class flat_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using key_compare = Compare;
+  using key_container_type = s21::vector<K>;
+  using mapped_container_type = s21::vector<V>;
+  using iterator = FlatMapIterator<K, V, false>;
+  using const_iterator = FlatMapIterator<K, V, true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = size_t;
+
+  flat_map() = default;
+  explicit flat_map(const Compare& comp);
+  flat_map(std::initializer_list<value_type> const& items);
+  // Sorts a copy of the input, O(n log n); the first of equal keys is
+  // kept, as if the pairs were inserted one by one
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last);
+  flat_map(const flat_map& m) = default;
+  flat_map(flat_map&& m) = default;
+  flat_map& operator=(const flat_map& m);
+  flat_map& operator=(flat_map&& m) = default;
+  ~flat_map() = default;
+
+  V& at(const K& key);
+  const V& at(const K& key) const;
+  V& operator[](const K& key);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+  const_reverse_iterator rbegin() const;
+  const_reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type n);
+  void shrink_to_fit();
+
+  void clear();
+  // O(n): the entries after the new one move up by one
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const K& key, const V& obj);
+  // O((n + m) + m log m) for m new entries
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj);
+  // Builds the value only when key is absent
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const K& key);
+  void swap(flat_map& other);
+  // Moves over the entries whose keys are new here in one merge; the
+  // others stay in other
+  void merge(flat_map& other);
+  // Sorts the arguments and merges them in one pass. Returns whether each
+  // argument was inserted: iterators would not survive the merge.
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const K& key) const;
+  size_type count(const K& key) const;
+  iterator find(const K& key);
+  const_iterator find(const K& key) const;
+  iterator lower_bound(const K& key);
+  const_iterator lower_bound(const K& key) const;
+  iterator upper_bound(const K& key);
+  const_iterator upper_bound(const K& key) const;
+  std::pair<iterator, iterator> equal_range(const K& key);
+  std::pair<const_iterator, const_iterator> equal_range(const K& key) const;
+  // Entries with lo <= key < hi
+  IteratorRange<const_iterator> range(const K& lo, const K& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const Key& key) const;
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const Key& key) const;
+
+  key_compare key_comp() const;
+  // The sorted keys and, at the same indices, their values
+  const key_container_type& keys() const;
+  const mapped_container_type& values() const;
+
+ private:
+  key_container_type keys_;
+  mapped_container_type values_;
+  Compare comp_;
+
+  // Index of the first key not less than key
+  template <typename Key>
+  size_type LowerIndex(const Key& key) const;
+  // Index of key, or size() when absent
+  template <typename Key>
+  size_type IndexOf(const Key& key) const;
+  iterator At(size_type index);
+  const_iterator At(size_type index) const;
+  // Merges items in, keeping the first of equal keys; when inserted is
+  // given, marks the items whose keys were not present
+  void Absorb(const std::vector<value_type>& items, bool* inserted);
+  iterator InsertAt(size_type index, const K& key, const V& obj);
+};
+}  // namespace s21
+
+#endif  // AVL_FLAT_MAP_H_
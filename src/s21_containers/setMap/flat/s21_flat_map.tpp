@@ -0,0 +1,402 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "s21_flat_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename Compare>
+flat_map<K, V, Compare>::flat_map(const Compare& comp)
+    : keys_(), values_(), comp_(comp) {}
+template <typename K, typename V, typename Compare>
+flat_map<K, V, Compare>::flat_map(
+    std::initializer_list<value_type> const& items)
+    : flat_map(items.begin(), items.end()) {}
+template <typename K, typename V, typename Compare>
+template <typename InputIt>
+flat_map<K, V, Compare>::flat_map(InputIt first, InputIt last)
+    : keys_(), values_(), comp_() {
+  insert(first, last);
+}
+template <typename K, typename V, typename Compare>
+flat_map<K, V, Compare>& flat_map<K, V, Compare>::operator=(
+    const flat_map& m) {
+  flat_map copy(m);
+  swap(copy);
+  return *this;
+}
+
+template <typename K, typename V, typename Compare>
+V& flat_map<K, V, Compare>::at(const K& key) {
+  size_type index = IndexOf(key);
+  if (index == size()) throw std::invalid_argument("This key doesn't exist");
+  return values_.data()[index];
+}
+template <typename K, typename V, typename Compare>
+const V& flat_map<K, V, Compare>::at(const K& key) const {
+  size_type index = IndexOf(key);
+  if (index == size()) throw std::invalid_argument("This key doesn't exist");
+  return values_.data()[index];
+}
+template <typename K, typename V, typename Compare>
+V& flat_map<K, V, Compare>::operator[](const K& key) {
+  return *try_emplace(key).first.value();
+}
+
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator flat_map<K, V, Compare>::begin() {
+  return At(0);
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator flat_map<K, V, Compare>::end() {
+  return At(size());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::begin() const {
+  return At(0);
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::end() const {
+  return At(size());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::reverse_iterator
+flat_map<K, V, Compare>::rbegin() {
+  return reverse_iterator(end());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::reverse_iterator
+flat_map<K, V, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_reverse_iterator
+flat_map<K, V, Compare>::rbegin() const {
+  return const_reverse_iterator(end());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_reverse_iterator
+flat_map<K, V, Compare>::rend() const {
+  return const_reverse_iterator(begin());
+}
+
+template <typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::empty() const {
+  return keys_.empty();
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::size_type flat_map<K, V, Compare>::size()
+    const {
+  return keys_.size();
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::size_type
+flat_map<K, V, Compare>::max_size() const {
+  return std::min(keys_.max_size(), values_.max_size());
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::size_type
+flat_map<K, V, Compare>::capacity() const {
+  return std::min(keys_.capacity(), values_.capacity());
+}
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::reserve(size_type n) {
+  keys_.reserve(n);
+  values_.reserve(n);
+}
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::shrink_to_fit() {
+  keys_.shrink_to_fit();
+  values_.shrink_to_fit();
+}
+
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::clear() {
+  key_container_type().swap(keys_);
+  mapped_container_type().swap(values_);
+}
+template <typename K, typename V, typename Compare>
+std::pair<typename flat_map<K, V, Compare>::iterator, bool>
+flat_map<K, V, Compare>::insert(const value_type& value) {
+  return insert(value.first, value.second);
+}
+template <typename K, typename V, typename Compare>
+std::pair<typename flat_map<K, V, Compare>::iterator, bool>
+flat_map<K, V, Compare>::insert(const K& key, const V& obj) {
+  size_type index = LowerIndex(key);
+  if (index < size() && !comp_(key, keys_.data()[index])) {
+    return {At(index), false};
+  }
+  return {InsertAt(index, key, obj), true};
+}
+template <typename K, typename V, typename Compare>
+template <typename InputIt>
+void flat_map<K, V, Compare>::insert(InputIt first, InputIt last) {
+  std::vector<value_type> items(first, last);
+  Absorb(items, nullptr);
+}
+template <typename K, typename V, typename Compare>
+template <typename M>
+std::pair<typename flat_map<K, V, Compare>::iterator, bool>
+flat_map<K, V, Compare>::insert_or_assign(const K& key, M&& obj) {
+  size_type index = LowerIndex(key);
+  if (index < size() && !comp_(key, keys_.data()[index])) {
+    values_.data()[index] = std::forward<M>(obj);
+    return {At(index), false};
+  }
+  return {InsertAt(index, key, V(std::forward<M>(obj))), true};
+}
+template <typename K, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename flat_map<K, V, Compare>::iterator, bool>
+flat_map<K, V, Compare>::try_emplace(const K& key, Args&&... args) {
+  size_type index = LowerIndex(key);
+  if (index < size() && !comp_(key, keys_.data()[index])) {
+    return {At(index), false};
+  }
+  return {InsertAt(index, key, V(std::forward<Args>(args)...)), true};
+}
+template <typename K, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename flat_map<K, V, Compare>::iterator, bool>
+flat_map<K, V, Compare>::emplace(Args&&... args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+// s21::vector::pop_back only shrinks the size and never destroys, so the
+// freed last slots are moved out into temporaries to let go of their
+// resources
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::erase(iterator pos) {
+  size_type index = pos.key() - keys_.data();
+  size_type last = size() - 1;
+  K* keys = keys_.data();
+  V* values = values_.data();
+  std::move(keys + index + 1, keys + size(), keys + index);
+  std::move(values + index + 1, values + size(), values + index);
+  K(std::move(keys[last]));
+  V(std::move(values[last]));
+  keys_.pop_back();
+  values_.pop_back();
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::size_type flat_map<K, V, Compare>::erase(
+    const K& key) {
+  size_type index = IndexOf(key);
+  if (index == size()) return 0;
+  erase(At(index));
+  return 1;
+}
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::swap(flat_map& other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::merge(flat_map& other) {
+  if (this == &other) return;
+  std::vector<value_type> items(other.begin(), other.end());
+  s21::vector<bool> inserted(items.size());
+  Absorb(items, inserted.data());
+  // The leftovers are sorted: appending keeps other ordered
+  flat_map rest(other.comp_);
+  rest.reserve(items.size());
+  for (size_type i = 0; i < items.size(); i++) {
+    if (!inserted.data()[i]) {
+      rest.InsertAt(rest.size(), items[i].first, items[i].second);
+    }
+  }
+  other.swap(rest);
+}
+template <typename K, typename V, typename Compare>
+template <typename... Args>
+s21::vector<bool> flat_map<K, V, Compare>::insert_many(Args&&... args) {
+  std::vector<value_type> items;
+  items.reserve(sizeof...(args));
+  (items.emplace_back(std::forward<Args>(args)), ...);
+  s21::vector<bool> inserted(items.size());
+  Absorb(items, inserted.data());
+  return inserted;
+}
+
+template <typename K, typename V, typename Compare>
+bool flat_map<K, V, Compare>::contains(const K& key) const {
+  return IndexOf(key) != size();
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::size_type flat_map<K, V, Compare>::count(
+    const K& key) const {
+  return contains(key) ? 1 : 0;
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator flat_map<K, V, Compare>::find(
+    const K& key) {
+  return At(IndexOf(key));
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::find(const K& key) const {
+  return At(IndexOf(key));
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator
+flat_map<K, V, Compare>::lower_bound(const K& key) {
+  return At(LowerIndex(key));
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::lower_bound(const K& key) const {
+  return At(LowerIndex(key));
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator
+flat_map<K, V, Compare>::upper_bound(const K& key) {
+  const K* keys = keys_.data();
+  return At(FlatUpperBound(keys, size(), key, comp_) - keys);
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::upper_bound(const K& key) const {
+  const K* keys = keys_.data();
+  return At(FlatUpperBound(keys, size(), key, comp_) - keys);
+}
+template <typename K, typename V, typename Compare>
+std::pair<typename flat_map<K, V, Compare>::iterator,
+          typename flat_map<K, V, Compare>::iterator>
+flat_map<K, V, Compare>::equal_range(const K& key) {
+  size_type first = LowerIndex(key);
+  bool found = first < size() && !comp_(key, keys_.data()[first]);
+  return {At(first), At(first + found)};
+}
+template <typename K, typename V, typename Compare>
+std::pair<typename flat_map<K, V, Compare>::const_iterator,
+          typename flat_map<K, V, Compare>::const_iterator>
+flat_map<K, V, Compare>::equal_range(const K& key) const {
+  size_type first = LowerIndex(key);
+  bool found = first < size() && !comp_(key, keys_.data()[first]);
+  return {At(first), At(first + found)};
+}
+template <typename K, typename V, typename Compare>
+IteratorRange<typename flat_map<K, V, Compare>::const_iterator>
+flat_map<K, V, Compare>::range(const K& lo, const K& hi) const {
+  size_type first = LowerIndex(lo);
+  return {At(first), At(std::max(first, LowerIndex(hi)))};
+}
+template <typename K, typename V, typename Compare>
+template <typename Key, typename C, typename>
+bool flat_map<K, V, Compare>::contains(const Key& key) const {
+  return IndexOf(key) != size();
+}
+template <typename K, typename V, typename Compare>
+template <typename Key, typename C, typename>
+typename flat_map<K, V, Compare>::const_iterator
+flat_map<K, V, Compare>::find(const Key& key) const {
+  return At(IndexOf(key));
+}
+
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::key_compare
+flat_map<K, V, Compare>::key_comp() const {
+  return comp_;
+}
+template <typename K, typename V, typename Compare>
+const typename flat_map<K, V, Compare>::key_container_type&
+flat_map<K, V, Compare>::keys() const {
+  return keys_;
+}
+template <typename K, typename V, typename Compare>
+const typename flat_map<K, V, Compare>::mapped_container_type&
+flat_map<K, V, Compare>::values() const {
+  return values_;
+}
+
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename flat_map<K, V, Compare>::size_type
+flat_map<K, V, Compare>::LowerIndex(const Key& key) const {
+  const K* keys = keys_.data();
+  return FlatLowerBound(keys, size(), key, comp_) - keys;
+}
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename flat_map<K, V, Compare>::size_type flat_map<K, V, Compare>::IndexOf(
+    const Key& key) const {
+  size_type index = LowerIndex(key);
+  if (index < size() && !comp_(key, keys_.data()[index])) return index;
+  return size();
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator flat_map<K, V, Compare>::At(
+    size_type index) {
+  return iterator(keys_.data() + index, values_.data() + index);
+}
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::const_iterator flat_map<K, V, Compare>::At(
+    size_type index) const {
+  return const_iterator(keys_.data() + index, values_.data() + index);
+}
+
+// As flat_set::Absorb: positions are sorted, then one pass merges
+template <typename K, typename V, typename Compare>
+void flat_map<K, V, Compare>::Absorb(const std::vector<value_type>& items,
+                                     bool* inserted) {
+  size_t m = items.size();
+  if (inserted != nullptr) std::fill(inserted, inserted + m, false);
+  if (m == 0) return;
+  std::vector<size_t> order(m);
+  std::iota(order.begin(), order.end(), 0);
+  auto by_key = [&](size_t a, size_t b) {
+    return comp_(items[a].first, items[b].first);
+  };
+  if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+    std::stable_sort(order.begin(), order.end(), by_key);
+  }
+  K* old_keys = keys_.data();
+  V* old_values = values_.data();
+  size_t n = size();
+  key_container_type keys;
+  mapped_container_type values;
+  keys.reserve(n + m);
+  values.reserve(n + m);
+  size_t i = 0;
+  for (size_t j = 0; j < m;) {
+    const value_type& item = items[order[j]];
+    for (; i < n && comp_(old_keys[i], item.first); i++) {
+      keys.push_back(FlatTake(old_keys[i]));
+      values.push_back(FlatTake(old_values[i]));
+    }
+    if (i == n || comp_(item.first, old_keys[i])) {
+      keys.push_back(item.first);
+      values.push_back(item.second);
+      if (inserted != nullptr) inserted[order[j]] = true;
+    }
+    for (j++; j < m && !comp_(item.first, items[order[j]].first);) j++;
+  }
+  for (; i < n; i++) {
+    keys.push_back(FlatTake(old_keys[i]));
+    values.push_back(FlatTake(old_values[i]));
+  }
+  keys_.swap(keys);
+  values_.swap(values);
+}
+// push_back makes room at the end, rotate brings the entry into place.
+// A failed value copy takes the new key back out.
+template <typename K, typename V, typename Compare>
+typename flat_map<K, V, Compare>::iterator flat_map<K, V, Compare>::InsertAt(
+    size_type index, const K& key, const V& obj) {
+  keys_.push_back(key);
+  try {
+    values_.push_back(obj);
+  } catch (...) {
+    keys_.pop_back();
+    throw;
+  }
+  K* keys = keys_.data();
+  V* values = values_.data();
+  std::rotate(keys + index, keys + size() - 1, keys + size());
+  std::rotate(values + index, values + size() - 1, values + size());
+  return At(index);
+}
+}  // namespace s21
@@ -0,0 +1,110 @@
+#ifndef SRC_FLAT_MAP_ITERATOR_H_
+#define SRC_FLAT_MAP_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Random access iterator over the parallel key and value arrays of a
+// flat_map. There is no stored pair to point at, so dereferencing yields
+// a pair of references, std::pair<const K&, V&>, by value; -> goes
+// through a proxy that holds it. Bind elements with auto or const auto&.
+template <typename K, typename V, bool kConst>
+class FlatMapIterator {
+ public:
+  using mapped_pointer = std::conditional_t<kConst, const V*, V*>;
+  using value_type = std::pair<K, V>;
+  using reference =
+      std::pair<const K&, std::conditional_t<kConst, const V&, V&>>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+  class pointer {
+   public:
+    explicit pointer(reference ref) : ref_(ref) {}
+    reference* operator->() { return &ref_; }
+
+   private:
+    reference ref_;
+  };
+
+  FlatMapIterator() : key_(nullptr), value_(nullptr) {}
+  FlatMapIterator(const K* key, mapped_pointer value)
+      : key_(key), value_(value) {}
+  // iterator converts to const_iterator
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  FlatMapIterator(const FlatMapIterator<K, V, kOther>& other)
+      : key_(other.key()), value_(other.value()) {}
+
+  reference operator*() const { return {*key_, *value_}; }
+  pointer operator->() const { return pointer(**this); }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  FlatMapIterator& operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+  FlatMapIterator operator++(int) {
+    FlatMapIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  FlatMapIterator& operator--() {
+    --key_;
+    --value_;
+    return *this;
+  }
+  FlatMapIterator operator--(int) {
+    FlatMapIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+  FlatMapIterator& operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+  FlatMapIterator& operator-=(difference_type n) { return *this += -n; }
+  FlatMapIterator operator+(difference_type n) const {
+    FlatMapIterator tmp = *this;
+    return tmp += n;
+  }
+  FlatMapIterator operator-(difference_type n) const {
+    FlatMapIterator tmp = *this;
+    return tmp -= n;
+  }
+  difference_type operator-(const FlatMapIterator& other) const {
+    return key_ - other.key_;
+  }
+
+  bool operator==(const FlatMapIterator& other) const {
+    return key_ == other.key_;
+  }
+  bool operator!=(const FlatMapIterator& other) const {
+    return key_ != other.key_;
+  }
+  bool operator<(const FlatMapIterator& other) const {
+    return key_ < other.key_;
+  }
+  bool operator>(const FlatMapIterator& other) const {
+    return other < *this;
+  }
+  bool operator<=(const FlatMapIterator& other) const {
+    return !(other < *this);
+  }
+  bool operator>=(const FlatMapIterator& other) const {
+    return !(*this < other);
+  }
+
+  const K* key() const { return key_; }
+  mapped_pointer value() const { return value_; }
+
+ private:
+  const K* key_;
+  mapped_pointer value_;
+};
+}  // namespace s21
+
+#endif  // SRC_FLAT_MAP_ITERATOR_H_
@@ -0,0 +1,72 @@
+#ifndef SRC_FLAT_SEARCH_H_
+#define SRC_FLAT_SEARCH_H_
+
+#include <cstddef>
+#include <type_traits>
+
+namespace s21 {
+// An element of a buffer that is about to be discarded, to be moved out of
+// it. When moving may throw it is copied instead, so that a merge that
+// fails half way leaves the buffer whole.
+template <typename T>
+typename std::conditional<std::is_nothrow_move_assignable<T>::value, T&&,
+                          const T&>::type
+FlatTake(T& element) {
+  return std::move(element);
+}
+// Binary search over a sorted array. For arithmetic elements every step
+// halves the range with a conditional move instead of a jump, so there is
+// no branch to mispredict and the loop runs log2(n) times for any key.
+// Other elements keep the branches: their comparisons cost more than a
+// misprediction, and speculating past them overlaps the memory loads.
+template <typename T, typename K, typename Compare>
+const T* FlatLowerBound(const T* first, size_t n, const K& key,
+                        const Compare& comp) {
+  if constexpr (std::is_arithmetic<T>::value) {
+    if (n == 0) return first;
+    while (n > 1) {
+      size_t half = n / 2;
+      first = comp(first[half], key) ? first + half : first;
+      n -= half;
+    }
+    return first + comp(*first, key);
+  } else {
+    while (n > 0) {
+      size_t half = n / 2;
+      if (comp(first[half], key)) {
+        first += half + 1;
+        n -= half + 1;
+      } else {
+        n = half;
+      }
+    }
+    return first;
+  }
+}
+template <typename T, typename K, typename Compare>
+const T* FlatUpperBound(const T* first, size_t n, const K& key,
+                        const Compare& comp) {
+  if constexpr (std::is_arithmetic<T>::value) {
+    if (n == 0) return first;
+    while (n > 1) {
+      size_t half = n / 2;
+      first = comp(key, first[half]) ? first : first + half;
+      n -= half;
+    }
+    return first + !comp(key, *first);
+  } else {
+    while (n > 0) {
+      size_t half = n / 2;
+      if (!comp(key, first[half])) {
+        first += half + 1;
+        n -= half + 1;
+      } else {
+        n = half;
+      }
+    }
+    return first;
+  }
+}
+}  // namespace s21
+
+#endif  // SRC_FLAT_SEARCH_H_
@@ -0,0 +1,115 @@
+#ifndef AVL_FLAT_SET_H_
+#define AVL_FLAT_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_flat_search.h"
+
+namespace s21 {
+// set as a sorted s21::vector: same interface as s21::set, minus node
+// handles, set algebra and order statistics. Lookups binary search
+// contiguous keys, branch-free for arithmetic ones, with no pointers to
+// chase and no per-element allocation. Built for tables that are filled
+// once and then read: a single insert or erase shifts the elements after
+// it, O(n), and invalidates all iterators. Bulk inserts sort and merge in
+// one pass.
+//
+// Elements must be default constructible and copy assignable: s21::vector
+// allocates its slots with new T[n] and fills them by assignment.
+template <typename T, typename Compare = std::less<T>>
+class flat_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using container_type = s21::vector<T>;
+  // Elements are keys, so they are never handed out for writing
+  using iterator = const T*;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  flat_set() = default;
+  explicit flat_set(const Compare& comp);
+  flat_set(std::initializer_list<value_type> const& items);
+  // Sorts a copy of the input, O(n log n); the first of equal elements
+  // is kept, as if they were inserted one by one
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last);
+  flat_set(const flat_set& s) = default;
+  flat_set(flat_set&& s) = default;
+  flat_set& operator=(const flat_set& s);
+  flat_set& operator=(flat_set&& s) = default;
+  ~flat_set() = default;
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type n);
+  void shrink_to_fit();
+
+  void clear();
+  // O(n): the elements after value move up by one
+  std::pair<iterator, bool> insert(const T& value);
+  // Skips the search when value belongs right before hint
+  iterator insert(iterator hint, const T& value);
+  // O((n + m) + m log m) for m new elements
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(flat_set& other);
+  // Moves every element of other over in one merge, other ends empty
+  void merge(flat_set& other);
+  // Sorts the arguments and merges them in one pass. Returns whether each
+  // argument was inserted: iterators would not survive the merge.
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  size_type count(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with lo <= key < hi
+  IteratorRange<iterator> range(const T& lo, const T& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+
+  key_compare key_comp() const;
+  // The sorted elements
+  const container_type& keys() const;
+
+ private:
+  container_type keys_;
+  Compare comp_;
+
+  // Merges items in, keeping the first of equal ones; when inserted is
+  // given, marks the items that were not present
+  void Absorb(const std::vector<T>& items, bool* inserted);
+  std::pair<iterator, bool> InsertAt(size_type index, const T& value);
+};
+}  // namespace s21
+
+#endif  // AVL_FLAT_SET_H_
@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <numeric>
+
+#include "s21_flat_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+flat_set<T, Compare>::flat_set(const Compare& comp) : keys_(), comp_(comp) {}
+template <typename T, typename Compare>
+flat_set<T, Compare>::flat_set(std::initializer_list<value_type> const& items)
+    : flat_set(items.begin(), items.end()) {}
+template <typename T, typename Compare>
+template <typename InputIt>
+flat_set<T, Compare>::flat_set(InputIt first, InputIt last)
+    : keys_(), comp_() {
+  insert(first, last);
+}
+template <typename T, typename Compare>
+flat_set<T, Compare>& flat_set<T, Compare>::operator=(const flat_set& s) {
+  flat_set copy(s);
+  swap(copy);
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::begin() const {
+  return keys_.data();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::end() const {
+  return keys_.data() + keys_.size();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::reverse_iterator flat_set<T, Compare>::rbegin()
+    const {
+  return reverse_iterator(end());
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::reverse_iterator flat_set<T, Compare>::rend()
+    const {
+  return reverse_iterator(begin());
+}
+
+template <typename T, typename Compare>
+bool flat_set<T, Compare>::empty() const {
+  return keys_.empty();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::size_type flat_set<T, Compare>::size() const {
+  return keys_.size();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::size_type flat_set<T, Compare>::max_size()
+    const {
+  return keys_.max_size();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::size_type flat_set<T, Compare>::capacity()
+    const {
+  return keys_.capacity();
+}
+template <typename T, typename Compare>
+void flat_set<T, Compare>::reserve(size_type n) {
+  keys_.reserve(n);
+}
+template <typename T, typename Compare>
+void flat_set<T, Compare>::shrink_to_fit() {
+  keys_.shrink_to_fit();
+}
+
+template <typename T, typename Compare>
+void flat_set<T, Compare>::clear() {
+  container_type().swap(keys_);
+}
+template <typename T, typename Compare>
+std::pair<typename flat_set<T, Compare>::iterator, bool>
+flat_set<T, Compare>::insert(const T& value) {
+  iterator pos = lower_bound(value);
+  if (pos != end() && !comp_(value, *pos)) return {pos, false};
+  return InsertAt(pos - begin(), value);
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::insert(
+    iterator hint, const T& value) {
+  if ((hint == end() || comp_(value, *hint)) &&
+      (hint == begin() || comp_(*(hint - 1), value))) {
+    return InsertAt(hint - begin(), value).first;
+  }
+  return insert(value).first;
+}
+template <typename T, typename Compare>
+template <typename InputIt>
+void flat_set<T, Compare>::insert(InputIt first, InputIt last) {
+  std::vector<T> items(first, last);
+  Absorb(items, nullptr);
+}
+template <typename T, typename Compare>
+template <typename... Args>
+std::pair<typename flat_set<T, Compare>::iterator, bool>
+flat_set<T, Compare>::emplace(Args&&... args) {
+  return insert(T(std::forward<Args>(args)...));
+}
+// s21::vector::pop_back only shrinks the size and never destroys, so the
+// freed last slot is moved out into a temporary to let go of its resources
+template <typename T, typename Compare>
+void flat_set<T, Compare>::erase(iterator pos) {
+  T* data = keys_.data();
+  T* at = data + (pos - begin());
+  std::move(at + 1, data + keys_.size(), at);
+  T(std::move(data[keys_.size() - 1]));
+  keys_.pop_back();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::size_type flat_set<T, Compare>::erase(
+    const T& key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+  erase(pos);
+  return 1;
+}
+template <typename T, typename Compare>
+void flat_set<T, Compare>::swap(flat_set& other) {
+  keys_.swap(other.keys_);
+  std::swap(comp_, other.comp_);
+}
+template <typename T, typename Compare>
+void flat_set<T, Compare>::merge(flat_set& other) {
+  if (this == &other) return;
+  insert(other.begin(), other.end());
+  other.clear();
+}
+template <typename T, typename Compare>
+template <typename... Args>
+s21::vector<bool> flat_set<T, Compare>::insert_many(Args&&... args) {
+  std::vector<T> items;
+  items.reserve(sizeof...(args));
+  (items.emplace_back(std::forward<Args>(args)), ...);
+  s21::vector<bool> inserted(items.size());
+  Absorb(items, inserted.data());
+  return inserted;
+}
+
+template <typename T, typename Compare>
+bool flat_set<T, Compare>::contains(const T& key) const {
+  return find(key) != end();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::find(
+    const T& key) const {
+  iterator pos = lower_bound(key);
+  return pos != end() && !comp_(key, *pos) ? pos : end();
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::size_type flat_set<T, Compare>::count(
+    const T& key) const {
+  return contains(key) ? 1 : 0;
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::lower_bound(
+    const T& key) const {
+  return FlatLowerBound(begin(), size(), key, comp_);
+}
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::upper_bound(
+    const T& key) const {
+  return FlatUpperBound(begin(), size(), key, comp_);
+}
+template <typename T, typename Compare>
+std::pair<typename flat_set<T, Compare>::iterator,
+          typename flat_set<T, Compare>::iterator>
+flat_set<T, Compare>::equal_range(const T& key) const {
+  iterator first = lower_bound(key);
+  iterator last = first != end() && !comp_(key, *first) ? first + 1 : first;
+  return {first, last};
+}
+template <typename T, typename Compare>
+IteratorRange<typename flat_set<T, Compare>::iterator>
+flat_set<T, Compare>::range(const T& lo, const T& hi) const {
+  iterator first = lower_bound(lo);
+  return {first, std::max(first, lower_bound(hi))};
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+bool flat_set<T, Compare>::contains(const K& key) const {
+  return find(key) != end();
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_set<T, Compare>::iterator flat_set<T, Compare>::find(
+    const K& key) const {
+  iterator pos = FlatLowerBound(begin(), size(), key, comp_);
+  return pos != end() && !comp_(key, *pos) ? pos : end();
+}
+
+template <typename T, typename Compare>
+typename flat_set<T, Compare>::key_compare flat_set<T, Compare>::key_comp()
+    const {
+  return comp_;
+}
+template <typename T, typename Compare>
+const typename flat_set<T, Compare>::container_type&
+flat_set<T, Compare>::keys() const {
+  return keys_;
+}
+
+// Sorts positions rather than the items, so that the first of equal items
+// is known; then one pass over both sorted sequences builds the result
+template <typename T, typename Compare>
+void flat_set<T, Compare>::Absorb(const std::vector<T>& items,
+                                  bool* inserted) {
+  size_t m = items.size();
+  if (inserted != nullptr) std::fill(inserted, inserted + m, false);
+  if (m == 0) return;
+  std::vector<size_t> order(m);
+  std::iota(order.begin(), order.end(), 0);
+  auto by_key = [&](size_t a, size_t b) {
+    return comp_(items[a], items[b]);
+  };
+  if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+    std::stable_sort(order.begin(), order.end(), by_key);
+  }
+  T* old = keys_.data();
+  size_t n = keys_.size();
+  container_type merged;
+  merged.reserve(n + m);
+  size_t i = 0;
+  for (size_t j = 0; j < m;) {
+    const T& item = items[order[j]];
+    for (; i < n && comp_(old[i], item); i++) {
+      merged.push_back(FlatTake(old[i]));
+    }
+    if (i == n || comp_(item, old[i])) {
+      merged.push_back(item);
+      if (inserted != nullptr) inserted[order[j]] = true;
+    }
+    for (j++; j < m && !comp_(item, items[order[j]]);) j++;
+  }
+  for (; i < n; i++) merged.push_back(FlatTake(old[i]));
+  keys_.swap(merged);
+}
+// push_back makes room at the end, rotate brings value into place
+template <typename T, typename Compare>
+std::pair<typename flat_set<T, Compare>::iterator, bool>
+flat_set<T, Compare>::InsertAt(size_type index, const T& value) {
+  keys_.push_back(value);
+  T* data = keys_.data();
+  std::rotate(data + index, data + keys_.size() - 1, data + keys_.size());
+  return {data + index, true};
+}
+}  // namespace s21
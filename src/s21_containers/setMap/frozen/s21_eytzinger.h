@@ -0,0 +1,111 @@
+#ifndef SRC_EYTZINGER_H_
+#define SRC_EYTZINGER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace s21 {
+// Eytzinger (BFS) layout of n sorted keys in slots 1..n of an array: the
+// children of slot k are 2k and 2k + 1, so the array is a complete binary
+// search tree with no pointers. Slot 0 stands for "none" and for end().
+
+// Leftmost and rightmost slots, 0 when n is 0
+inline size_t EytzingerFirst(size_t n) {
+  return n == 0 ? 0 : size_t(1) << (63 - __builtin_clzll(n));
+}
+inline size_t EytzingerLast(size_t n) {
+  return (size_t(1) << (63 - __builtin_clzll(n + 1))) - 1;
+}
+// Climbs from the slot below the leaves back to where the walk last went
+// left: a shift by the number of trailing one bits plus one
+inline size_t EytzingerLastLeft(size_t k) {
+  return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+}
+// In-order successor: the leftmost slot under the right child, else up
+// past every ancestor k is a right child of
+inline size_t EytzingerNext(size_t k, size_t n) {
+  if (2 * k + 1 <= n) {
+    k = 2 * k + 1;
+    while (2 * k <= n) k *= 2;
+    return k;
+  }
+  return EytzingerLastLeft(k);
+}
+// In-order predecessor; the predecessor of 0 is the last slot
+inline size_t EytzingerPrev(size_t k, size_t n) {
+  if (k == 0) return EytzingerLast(n);
+  if (2 * k <= n) {
+    k = 2 * k;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  return k >> (__builtin_ctzll(k) + 1);
+}
+// Calls visit(slot, i) for the i-th smallest key, i = 0..n-1, which is how
+// a sorted sequence is laid out
+template <typename Visit>
+void EytzingerVisit(size_t n, Visit visit) {
+  size_t k = EytzingerFirst(n);
+  for (size_t i = 0; i < n; i++, k = EytzingerNext(k, n)) visit(k, i);
+}
+
+// How many slots ahead the search prefetches: the 2^j descendants of k
+// sit together at k * 2^j, so with 2^j keys to a 64 byte line one
+// prefetch covers the whole level j steps down
+template <typename T>
+constexpr size_t EytzingerStride() {
+  size_t stride = 2;
+  while (stride * 2 * sizeof(T) <= 64) stride *= 2;
+  return stride;
+}
+// Prefetching never faults, so the address is not clamped to the array;
+// it is computed as an integer so that no out of range pointer is formed.
+// Clamping costs a compare per level and was measurably slower.
+template <typename T>
+void EytzingerPrefetch(const T* slots, size_t k) {
+  __builtin_prefetch(reinterpret_cast<const void*>(
+      reinterpret_cast<uintptr_t>(slots) +
+      k * EytzingerStride<T>() * sizeof(T)));
+}
+// Slot of the first key not less than key (LowerBound) or greater than
+// key (UpperBound), 0 when there is none. Each step goes down by
+// k = 2k + (go right). For arithmetic keys that is a conditional add, no
+// branch to mispredict and one step per level whatever the keys; other
+// keys keep the branch, as in FlatLowerBound, since speculating past
+// their costlier comparisons overlaps the loads.
+template <typename T, typename K, typename Compare>
+size_t EytzingerLowerBound(const T* slots, size_t n, const K& key,
+                           const Compare& comp) {
+  size_t k = 1;
+  while (k <= n) {
+    EytzingerPrefetch(slots, k);
+    if constexpr (std::is_arithmetic<T>::value) {
+      k = 2 * k + comp(slots[k], key);
+    } else if (comp(slots[k], key)) {
+      k = 2 * k + 1;
+    } else {
+      k = 2 * k;
+    }
+  }
+  return EytzingerLastLeft(k);
+}
+template <typename T, typename K, typename Compare>
+size_t EytzingerUpperBound(const T* slots, size_t n, const K& key,
+                           const Compare& comp) {
+  size_t k = 1;
+  while (k <= n) {
+    EytzingerPrefetch(slots, k);
+    if constexpr (std::is_arithmetic<T>::value) {
+      k = 2 * k + !comp(key, slots[k]);
+    } else if (!comp(key, slots[k])) {
+      k = 2 * k + 1;
+    } else {
+      k = 2 * k;
+    }
+  }
+  return EytzingerLastLeft(k);
+}
+}  // namespace s21
+
+#endif  // SRC_EYTZINGER_H_
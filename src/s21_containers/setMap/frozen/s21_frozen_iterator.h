@@ -0,0 +1,126 @@
+#ifndef SRC_FROZEN_ITERATOR_H_
+#define SRC_FROZEN_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "s21_eytzinger.h"
+
+namespace s21 {
+// Bidirectional iterator over an Eytzinger array in key order. It holds a
+// slot index and steps to the in-order neighbour with index arithmetic,
+// O(1) amortized; slot 0 is end().
+template <typename T>
+class FrozenIterator {
+ public:
+  using value_type = T;
+  using reference = const T&;
+  using pointer = const T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  FrozenIterator() : slots_(nullptr), size_(0), index_(0) {}
+  FrozenIterator(const T* slots, size_t size, size_t index)
+      : slots_(slots), size_(size), index_(index) {}
+
+  reference operator*() const { return slots_[index_]; }
+  pointer operator->() const { return slots_ + index_; }
+
+  FrozenIterator& operator++() {
+    index_ = EytzingerNext(index_, size_);
+    return *this;
+  }
+  FrozenIterator operator++(int) {
+    FrozenIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  FrozenIterator& operator--() {
+    index_ = EytzingerPrev(index_, size_);
+    return *this;
+  }
+  FrozenIterator operator--(int) {
+    FrozenIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+  bool operator==(const FrozenIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const FrozenIterator& other) const {
+    return index_ != other.index_;
+  }
+
+  // Slot in the Eytzinger array, 0 for end()
+  size_t index() const { return index_; }
+
+ private:
+  const T* slots_;
+  size_t size_;
+  size_t index_;
+};
+
+// The same over the parallel key and value arrays of a frozen_map. As
+// with FlatMapIterator, dereferencing yields std::pair<const K&, const V&>
+// by value and -> goes through a proxy that holds it.
+template <typename K, typename V>
+class FrozenMapIterator {
+ public:
+  using value_type = std::pair<K, V>;
+  using reference = std::pair<const K&, const V&>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  class pointer {
+   public:
+    explicit pointer(reference ref) : ref_(ref) {}
+    reference* operator->() { return &ref_; }
+
+   private:
+    reference ref_;
+  };
+
+  FrozenMapIterator() : keys_(nullptr), values_(nullptr), size_(0), index_(0) {}
+  FrozenMapIterator(const K* keys, const V* values, size_t size,
+                    size_t index)
+      : keys_(keys), values_(values), size_(size), index_(index) {}
+
+  reference operator*() const { return {keys_[index_], values_[index_]}; }
+  pointer operator->() const { return pointer(**this); }
+
+  FrozenMapIterator& operator++() {
+    index_ = EytzingerNext(index_, size_);
+    return *this;
+  }
+  FrozenMapIterator operator++(int) {
+    FrozenMapIterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+  FrozenMapIterator& operator--() {
+    index_ = EytzingerPrev(index_, size_);
+    return *this;
+  }
+  FrozenMapIterator operator--(int) {
+    FrozenMapIterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+  bool operator==(const FrozenMapIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const FrozenMapIterator& other) const {
+    return index_ != other.index_;
+  }
+
+  size_t index() const { return index_; }
+
+ private:
+  const K* keys_;
+  const V* values_;
+  size_t size_;
+  size_t index_;
+};
+}  // namespace s21
+
+#endif  // SRC_FROZEN_ITERATOR_H_
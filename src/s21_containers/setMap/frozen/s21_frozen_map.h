@@ -0,0 +1,93 @@
+#ifndef AVL_FROZEN_MAP_H_
+#define AVL_FROZEN_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_frozen_iterator.h"
+
+namespace s21 {
+// Read-only map laid out like frozen_set: keys in Eytzinger order in one
+// s21::vector and, in the same slots, their values in another, so that a
+// lookup touches only keys until it has found its slot.
+//
+// Iterators yield std::pair<const K&, const V&> by value, see
+// FrozenMapIterator. Keys and values must be default constructible and
+// copy assignable: s21::vector allocates its slots with new T[n] and fills
+// them by assignment.
+template <typename K, typename V, typename Compare = std::less<K>>
+class frozen_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using key_compare = Compare;
+  using key_container_type = s21::vector<K>;
+  using mapped_container_type = s21::vector<V>;
+  using iterator = FrozenMapIterator<K, V>;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  frozen_map() = default;
+  explicit frozen_map(const Compare& comp);
+  frozen_map(std::initializer_list<value_type> const& items);
+  // O(n) from input sorted by key such as an s21::map, O(n log n)
+  // otherwise; the first of equal keys is kept
+  template <typename InputIt>
+  frozen_map(InputIt first, InputIt last, const Compare& comp = Compare());
+  frozen_map(const frozen_map& m) = default;
+  frozen_map(frozen_map&& m) = default;
+  frozen_map& operator=(const frozen_map& m);
+  frozen_map& operator=(frozen_map&& m) = default;
+  ~frozen_map() = default;
+
+  const V& at(const K& key) const;
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void swap(frozen_map& other);
+
+  bool contains(const K& key) const;
+  size_type count(const K& key) const;
+  iterator find(const K& key) const;
+  iterator lower_bound(const K& key) const;
+  iterator upper_bound(const K& key) const;
+  std::pair<iterator, iterator> equal_range(const K& key) const;
+  // Entries with lo <= key < hi
+  IteratorRange<iterator> range(const K& lo, const K& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const Key& key) const;
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const Key& key) const;
+
+  key_compare key_comp() const;
+  // The keys in Eytzinger order in slots 1..size() and, in the same
+  // slots, their values; slot 0 is unused
+  const key_container_type& keys() const;
+  const mapped_container_type& values() const;
+
+ private:
+  key_container_type keys_;
+  mapped_container_type values_;
+  Compare comp_;
+
+  template <typename Key>
+  size_type IndexOf(const Key& key) const;
+  iterator At(size_type index) const;
+};
+}  // namespace s21
+
+#endif  // AVL_FROZEN_MAP_H_
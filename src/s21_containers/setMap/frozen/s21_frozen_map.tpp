@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "s21_frozen_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename Compare>
+frozen_map<K, V, Compare>::frozen_map(const Compare& comp)
+    : keys_(), values_(), comp_(comp) {}
+template <typename K, typename V, typename Compare>
+frozen_map<K, V, Compare>::frozen_map(
+    std::initializer_list<value_type> const& items)
+    : frozen_map(items.begin(), items.end()) {}
+// As in frozen_set: positions are sorted so that the first of equal keys
+// is known, then keys and values are laid out in one in-order walk
+template <typename K, typename V, typename Compare>
+template <typename InputIt>
+frozen_map<K, V, Compare>::frozen_map(InputIt first, InputIt last,
+                                      const Compare& comp)
+    : keys_(), values_(), comp_(comp) {
+  std::vector<value_type> items(first, last);
+  std::vector<size_t> order(items.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto by_key = [&](size_t a, size_t b) {
+    return comp_(items[a].first, items[b].first);
+  };
+  if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+    std::stable_sort(order.begin(), order.end(), by_key);
+  }
+  auto equal = [&](size_t a, size_t b) { return !by_key(a, b); };
+  order.erase(std::unique(order.begin(), order.end(), equal), order.end());
+  if (order.empty()) return;
+  key_container_type keys(order.size() + 1);
+  mapped_container_type values(order.size() + 1);
+  K* key_out = keys.data();
+  V* value_out = values.data();
+  EytzingerVisit(order.size(), [&](size_t k, size_t i) {
+    key_out[k] = items[order[i]].first;
+    value_out[k] = std::move(items[order[i]].second);
+  });
+  keys_.swap(keys);
+  values_.swap(values);
+}
+template <typename K, typename V, typename Compare>
+frozen_map<K, V, Compare>& frozen_map<K, V, Compare>::operator=(
+    const frozen_map& m) {
+  frozen_map copy(m);
+  swap(copy);
+  return *this;
+}
+
+template <typename K, typename V, typename Compare>
+const V& frozen_map<K, V, Compare>::at(const K& key) const {
+  size_type index = IndexOf(key);
+  if (index == 0) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return values_.data()[index];
+}
+
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator frozen_map<K, V, Compare>::begin()
+    const {
+  return At(EytzingerFirst(size()));
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator frozen_map<K, V, Compare>::end()
+    const {
+  return At(0);
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::reverse_iterator
+frozen_map<K, V, Compare>::rbegin() const {
+  return reverse_iterator(end());
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::reverse_iterator
+frozen_map<K, V, Compare>::rend() const {
+  return reverse_iterator(begin());
+}
+
+template <typename K, typename V, typename Compare>
+bool frozen_map<K, V, Compare>::empty() const {
+  return keys_.empty();
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::size_type frozen_map<K, V, Compare>::size()
+    const {
+  return keys_.empty() ? 0 : keys_.size() - 1;
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::size_type
+frozen_map<K, V, Compare>::max_size() const {
+  return keys_.max_size() - 1;
+}
+template <typename K, typename V, typename Compare>
+void frozen_map<K, V, Compare>::swap(frozen_map& other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename K, typename V, typename Compare>
+bool frozen_map<K, V, Compare>::contains(const K& key) const {
+  return IndexOf(key) != 0;
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::size_type frozen_map<K, V, Compare>::count(
+    const K& key) const {
+  return contains(key) ? 1 : 0;
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator frozen_map<K, V, Compare>::find(
+    const K& key) const {
+  return At(IndexOf(key));
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator
+frozen_map<K, V, Compare>::lower_bound(const K& key) const {
+  return At(EytzingerLowerBound(keys_.data(), size(), key, comp_));
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator
+frozen_map<K, V, Compare>::upper_bound(const K& key) const {
+  return At(EytzingerUpperBound(keys_.data(), size(), key, comp_));
+}
+template <typename K, typename V, typename Compare>
+std::pair<typename frozen_map<K, V, Compare>::iterator,
+          typename frozen_map<K, V, Compare>::iterator>
+frozen_map<K, V, Compare>::equal_range(const K& key) const {
+  iterator first = lower_bound(key);
+  iterator last = first;
+  if (first != end() && !comp_(key, first->first)) ++last;
+  return {first, last};
+}
+template <typename K, typename V, typename Compare>
+IteratorRange<typename frozen_map<K, V, Compare>::iterator>
+frozen_map<K, V, Compare>::range(const K& lo, const K& hi) const {
+  if (!comp_(lo, hi)) return IteratorRange<iterator>(end(), end());
+  return IteratorRange<iterator>(lower_bound(lo), lower_bound(hi));
+}
+template <typename K, typename V, typename Compare>
+template <typename Key, typename C, typename>
+bool frozen_map<K, V, Compare>::contains(const Key& key) const {
+  return IndexOf(key) != 0;
+}
+template <typename K, typename V, typename Compare>
+template <typename Key, typename C, typename>
+typename frozen_map<K, V, Compare>::iterator frozen_map<K, V, Compare>::find(
+    const Key& key) const {
+  return At(IndexOf(key));
+}
+
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::key_compare
+frozen_map<K, V, Compare>::key_comp() const {
+  return comp_;
+}
+template <typename K, typename V, typename Compare>
+const typename frozen_map<K, V, Compare>::key_container_type&
+frozen_map<K, V, Compare>::keys() const {
+  return keys_;
+}
+template <typename K, typename V, typename Compare>
+const typename frozen_map<K, V, Compare>::mapped_container_type&
+frozen_map<K, V, Compare>::values() const {
+  return values_;
+}
+
+template <typename K, typename V, typename Compare>
+template <typename Key>
+typename frozen_map<K, V, Compare>::size_type
+frozen_map<K, V, Compare>::IndexOf(const Key& key) const {
+  const K* keys = keys_.data();
+  size_t k = EytzingerLowerBound(keys, size(), key, comp_);
+  return k != 0 && !comp_(key, keys[k]) ? k : 0;
+}
+template <typename K, typename V, typename Compare>
+typename frozen_map<K, V, Compare>::iterator frozen_map<K, V, Compare>::At(
+    size_type index) const {
+  return iterator(keys_.data(), values_.data(), size(), index);
+}
+}  // namespace s21
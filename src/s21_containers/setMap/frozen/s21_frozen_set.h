@@ -0,0 +1,90 @@
+#ifndef AVL_FROZEN_SET_H_
+#define AVL_FROZEN_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+#include "s21_frozen_iterator.h"
+
+namespace s21 {
+// Read-only set for tables that are built once and then only queried,
+// e.g. frozen_set<int> f(s.begin(), s.end()) from an s21::set. The keys
+// sit in one s21::vector in Eytzinger order (see s21_eytzinger.h): a
+// lookup is a walk down an implicit tree with no pointers and no branch
+// on the comparisons, the top levels that every lookup shares stay in
+// cache, and each step prefetches the level several steps below.
+// Iteration still runs in key order.
+//
+// Elements must be default constructible and copy assignable: s21::vector
+// allocates its slots with new T[n] and fills them by assignment.
+template <typename T, typename Compare = std::less<T>>
+class frozen_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using container_type = s21::vector<T>;
+  using iterator = FrozenIterator<T>;
+  using const_iterator = iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  frozen_set() = default;
+  explicit frozen_set(const Compare& comp);
+  frozen_set(std::initializer_list<value_type> const& items);
+  // O(n) from sorted input such as an s21::set, O(n log n) otherwise; the
+  // first of equal elements is kept
+  template <typename InputIt>
+  frozen_set(InputIt first, InputIt last, const Compare& comp = Compare());
+  frozen_set(const frozen_set& s) = default;
+  frozen_set(frozen_set&& s) = default;
+  frozen_set& operator=(const frozen_set& s);
+  frozen_set& operator=(frozen_set&& s) = default;
+  ~frozen_set() = default;
+
+  iterator begin() const;
+  iterator end() const;
+  reverse_iterator rbegin() const;
+  reverse_iterator rend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void swap(frozen_set& other);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  size_type count(const T& key) const;
+  iterator lower_bound(const T& key) const;
+  iterator upper_bound(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+  // Elements with lo <= key < hi
+  IteratorRange<iterator> range(const T& lo, const T& hi) const;
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) const;
+
+  key_compare key_comp() const;
+  // The elements in Eytzinger order in slots 1..size(); slot 0 is unused
+  const container_type& slots() const;
+
+ private:
+  container_type slots_;
+  Compare comp_;
+
+  template <typename K>
+  size_type IndexOf(const K& key) const;
+  iterator At(size_type index) const;
+};
+}  // namespace s21
+
+#endif  // AVL_FROZEN_SET_H_
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <numeric>
+
+#include "s21_frozen_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+frozen_set<T, Compare>::frozen_set(const Compare& comp)
+    : slots_(), comp_(comp) {}
+template <typename T, typename Compare>
+frozen_set<T, Compare>::frozen_set(
+    std::initializer_list<value_type> const& items)
+    : frozen_set(items.begin(), items.end()) {}
+// Sorts positions rather than the items, so that the first of equal
+// items is known, then lays the survivors out in one in-order walk
+template <typename T, typename Compare>
+template <typename InputIt>
+frozen_set<T, Compare>::frozen_set(InputIt first, InputIt last,
+                                   const Compare& comp)
+    : slots_(), comp_(comp) {
+  std::vector<T> items(first, last);
+  std::vector<size_t> order(items.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto by_key = [&](size_t a, size_t b) {
+    return comp_(items[a], items[b]);
+  };
+  if (!std::is_sorted(order.begin(), order.end(), by_key)) {
+    std::stable_sort(order.begin(), order.end(), by_key);
+  }
+  auto equal = [&](size_t a, size_t b) { return !by_key(a, b); };
+  order.erase(std::unique(order.begin(), order.end(), equal), order.end());
+  if (order.empty()) return;
+  container_type slots(order.size() + 1);
+  T* out = slots.data();
+  EytzingerVisit(order.size(), [&](size_t k, size_t i) {
+    out[k] = std::move(items[order[i]]);
+  });
+  slots_.swap(slots);
+}
+template <typename T, typename Compare>
+frozen_set<T, Compare>& frozen_set<T, Compare>::operator=(
+    const frozen_set& s) {
+  frozen_set copy(s);
+  swap(copy);
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::begin()
+    const {
+  return At(EytzingerFirst(size()));
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::end()
+    const {
+  return At(0);
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::reverse_iterator
+frozen_set<T, Compare>::rbegin() const {
+  return reverse_iterator(end());
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::reverse_iterator
+frozen_set<T, Compare>::rend() const {
+  return reverse_iterator(begin());
+}
+
+template <typename T, typename Compare>
+bool frozen_set<T, Compare>::empty() const {
+  return slots_.empty();
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::size_type frozen_set<T, Compare>::size()
+    const {
+  return slots_.empty() ? 0 : slots_.size() - 1;
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::size_type frozen_set<T, Compare>::max_size()
+    const {
+  return slots_.max_size() - 1;
+}
+template <typename T, typename Compare>
+void frozen_set<T, Compare>::swap(frozen_set& other) {
+  slots_.swap(other.slots_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename T, typename Compare>
+bool frozen_set<T, Compare>::contains(const T& key) const {
+  return IndexOf(key) != 0;
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::find(
+    const T& key) const {
+  return At(IndexOf(key));
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::size_type frozen_set<T, Compare>::count(
+    const T& key) const {
+  return contains(key) ? 1 : 0;
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::lower_bound(
+    const T& key) const {
+  return At(EytzingerLowerBound(slots_.data(), size(), key, comp_));
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::upper_bound(
+    const T& key) const {
+  return At(EytzingerUpperBound(slots_.data(), size(), key, comp_));
+}
+template <typename T, typename Compare>
+std::pair<typename frozen_set<T, Compare>::iterator,
+          typename frozen_set<T, Compare>::iterator>
+frozen_set<T, Compare>::equal_range(const T& key) const {
+  iterator first = lower_bound(key);
+  iterator last = first;
+  if (first != end() && !comp_(key, *first)) ++last;
+  return {first, last};
+}
+template <typename T, typename Compare>
+IteratorRange<typename frozen_set<T, Compare>::iterator>
+frozen_set<T, Compare>::range(const T& lo, const T& hi) const {
+  if (!comp_(lo, hi)) return IteratorRange<iterator>(end(), end());
+  return IteratorRange<iterator>(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+bool frozen_set<T, Compare>::contains(const K& key) const {
+  return IndexOf(key) != 0;
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::find(
+    const K& key) const {
+  return At(IndexOf(key));
+}
+
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::key_compare frozen_set<T, Compare>::key_comp()
+    const {
+  return comp_;
+}
+template <typename T, typename Compare>
+const typename frozen_set<T, Compare>::container_type&
+frozen_set<T, Compare>::slots() const {
+  return slots_;
+}
+
+template <typename T, typename Compare>
+template <typename K>
+typename frozen_set<T, Compare>::size_type frozen_set<T, Compare>::IndexOf(
+    const K& key) const {
+  const T* slots = slots_.data();
+  size_t k = EytzingerLowerBound(slots, size(), key, comp_);
+  return k != 0 && !comp_(key, slots[k]) ? k : 0;
+}
+template <typename T, typename Compare>
+typename frozen_set<T, Compare>::iterator frozen_set<T, Compare>::At(
+    size_type index) const {
+  return iterator(slots_.data(), size(), index);
+}
+}  // namespace s21
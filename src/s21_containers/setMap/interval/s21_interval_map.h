@@ -0,0 +1,107 @@
+#ifndef AVL_INTERVAL_MAP_H_
+#define AVL_INTERVAL_MAP_H_
+
+#include <optional>
+#include <utility>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Orders half-open intervals [lo, hi) by lo, then by hi
+template <typename K, typename Compare>
+struct IntervalLess {
+  explicit IntervalLess(const Compare& compare = Compare())
+      : comp(compare) {}
+  bool operator()(const std::pair<K, K>& a, const std::pair<K, K>& b) const {
+    if (comp(a.first, b.first)) return true;
+    if (comp(b.first, a.first)) return false;
+    return comp(a.second, b.second);
+  }
+  Compare comp;
+};
+// Augmentation policy: the greatest interval end in a subtree. An empty
+// subtree has none, so any K and any order will do.
+template <typename K, typename Compare>
+struct MaxEndAggregate {
+  using value_type = std::optional<K>;
+  explicit MaxEndAggregate(const Compare& compare = Compare())
+      : comp(compare) {}
+  static value_type Identity() { return std::nullopt; }
+  template <typename U>
+  static value_type Lift(const U& value) {
+    return value.first.second;
+  }
+  value_type Combine(const value_type& a, const value_type& b) const {
+    if (!a) return b;
+    if (!b) return a;
+    return comp(*a, *b) ? b : a;
+  }
+  Compare comp;
+};
+
+// Map from half-open intervals [lo, hi) to values on the AVL engine.
+// Intervals may overlap. Every node keeps the greatest end in its subtree,
+// so overlap and point queries skip the subtrees that end too early and
+// cost O(log n + k log(n / k)) for k results, against O(n) for a scan.
+// Inserting an interval merges it with every entry of equal value that it
+// overlaps or touches. Iteration goes in order of lo, then hi.
+template <typename K, typename V, typename Compare = std::less<K>>
+class interval_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using interval_type = std::pair<K, K>;
+  using value_type = std::pair<const interval_type, V>;
+  using key_compare = Compare;
+  using tag_type = Augmented<V, MaxEndAggregate<K, Compare>>;
+  using tree_type = AVLTree<value_type, tag_type, IntervalLess<K, Compare>,
+                            SelectFirst<value_type>>;
+  using iterator = Iterator<value_type, tag_type>;
+  using size_type = size_t;
+
+  interval_map();
+  explicit interval_map(const Compare& comp);
+  interval_map(std::initializer_list<value_type> const& items);
+  interval_map(const interval_map& other) = default;
+  interval_map(interval_map&& other) = default;
+  interval_map& operator=(interval_map&& other) = default;
+  ~interval_map() = default;
+
+  iterator begin();
+  iterator end();
+  bool empty();
+  size_type size();
+  void clear();
+
+  // Returns the entry now covering [lo, hi), end() for an empty interval
+  iterator insert(const K& lo, const K& hi, const V& value);
+  iterator insert(const value_type& value);
+  void erase(iterator pos);
+
+  // Entries overlapping [lo, hi), in iteration order
+  s21::vector<iterator> overlapping(const K& lo, const K& hi);
+  // Entries whose interval contains point
+  s21::vector<iterator> containing(const K& point);
+  bool overlaps(const K& lo, const K& hi);
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  using tree_node = Node<value_type, tag_type>;
+
+  tree_type tree_;
+  Compare comp_;
+
+  iterator MakeIterator(tree_node* node) const;
+  // Calls visit on every node, in order, whose interval ends after the
+  // query (ends_after) and starts before it (starts_before); visit returns
+  // false to stop. Subtrees are skipped by their greatest end and by lo.
+  template <typename EndsAfter, typename StartsBefore, typename Visit>
+  bool Walk(tree_node* node, EndsAfter ends_after, StartsBefore starts_before,
+            Visit& visit);
+};
+}  // namespace s21
+
+#endif  // AVL_INTERVAL_MAP_H_
@@ -0,0 +1,156 @@
+#include "./s21_interval_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename Compare>
+interval_map<K, V, Compare>::interval_map() : interval_map(Compare()) {}
+template <typename K, typename V, typename Compare>
+interval_map<K, V, Compare>::interval_map(const Compare& comp)
+    : tree_(IntervalLess<K, Compare>(comp), MaxEndAggregate<K, Compare>(comp)),
+      comp_(comp) {}
+template <typename K, typename V, typename Compare>
+interval_map<K, V, Compare>::interval_map(
+    std::initializer_list<value_type> const& items)
+    : interval_map() {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::iterator
+interval_map<K, V, Compare>::begin() {
+  return MakeIterator(tree_.GetHeader()->leftmost);
+}
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::iterator
+interval_map<K, V, Compare>::end() {
+  return MakeIterator(nullptr);
+}
+template <typename K, typename V, typename Compare>
+bool interval_map<K, V, Compare>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::size_type
+interval_map<K, V, Compare>::size() {
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+template <typename K, typename V, typename Compare>
+void interval_map<K, V, Compare>::clear() {
+  if (tree_.GetRoot()) {
+    tree_.Clear(tree_.GetRoot());
+  }
+}
+
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::iterator
+interval_map<K, V, Compare>::insert(const K& lo, const K& hi,
+                                    const V& value) {
+  if (!comp_(lo, hi)) {
+    return end();
+  }
+  // Entries of equal value that overlap or touch [lo, hi) are absorbed.
+  // They never touch each other, so one pass finds them all.
+  std::vector<tree_node*> absorbed;
+  auto collect = [&](tree_node* node) {
+    if (node->key.second == value) absorbed.push_back(node);
+    return true;
+  };
+  Walk(
+      tree_.GetRoot(), [&](const K& end) { return !comp_(end, lo); },
+      [&](const K& start) { return !comp_(hi, start); }, collect);
+  K new_lo = lo;
+  K new_hi = hi;
+  for (tree_node* node : absorbed) {
+    if (comp_(node->key.first.first, new_lo)) new_lo = node->key.first.first;
+    if (comp_(new_hi, node->key.first.second)) new_hi = node->key.first.second;
+    tree_.Remove(node);
+  }
+  return MakeIterator(tree_.Insert_multiset(
+      value_type(interval_type(std::move(new_lo), std::move(new_hi)), value)));
+}
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::iterator
+interval_map<K, V, Compare>::insert(const value_type& value) {
+  return insert(value.first.first, value.first.second, value.second);
+}
+template <typename K, typename V, typename Compare>
+void interval_map<K, V, Compare>::erase(iterator pos) {
+  if (pos != nullptr) {
+    tree_.Remove(pos.GetNode());
+  }
+}
+
+template <typename K, typename V, typename Compare>
+s21::vector<typename interval_map<K, V, Compare>::iterator>
+interval_map<K, V, Compare>::overlapping(const K& lo, const K& hi) {
+  s21::vector<iterator> result;
+  if (!comp_(lo, hi)) {
+    return result;
+  }
+  auto add = [&](tree_node* node) {
+    result.push_back(MakeIterator(node));
+    return true;
+  };
+  Walk(
+      tree_.GetRoot(), [&](const K& end) { return comp_(lo, end); },
+      [&](const K& start) { return comp_(start, hi); }, add);
+  return result;
+}
+template <typename K, typename V, typename Compare>
+s21::vector<typename interval_map<K, V, Compare>::iterator>
+interval_map<K, V, Compare>::containing(const K& point) {
+  s21::vector<iterator> result;
+  auto add = [&](tree_node* node) {
+    result.push_back(MakeIterator(node));
+    return true;
+  };
+  Walk(
+      tree_.GetRoot(), [&](const K& end) { return comp_(point, end); },
+      [&](const K& start) { return !comp_(point, start); }, add);
+  return result;
+}
+template <typename K, typename V, typename Compare>
+bool interval_map<K, V, Compare>::overlaps(const K& lo, const K& hi) {
+  bool found = false;
+  auto stop = [&](tree_node*) {
+    found = true;
+    return false;
+  };
+  if (comp_(lo, hi)) {
+    Walk(
+        tree_.GetRoot(), [&](const K& end) { return comp_(lo, end); },
+        [&](const K& start) { return comp_(start, hi); }, stop);
+  }
+  return found;
+}
+
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::key_compare
+interval_map<K, V, Compare>::key_comp() const {
+  return comp_;
+}
+template <typename K, typename V, typename Compare>
+const typename interval_map<K, V, Compare>::tree_type&
+interval_map<K, V, Compare>::get_tree() const {
+  return tree_;
+}
+template <typename K, typename V, typename Compare>
+typename interval_map<K, V, Compare>::iterator
+interval_map<K, V, Compare>::MakeIterator(tree_node* node) const {
+  return iterator(node, tree_.GetHeader());
+}
+template <typename K, typename V, typename Compare>
+template <typename EndsAfter, typename StartsBefore, typename Visit>
+bool interval_map<K, V, Compare>::Walk(tree_node* node, EndsAfter ends_after,
+                                       StartsBefore starts_before,
+                                       Visit& visit) {
+  // a node's subtree is never empty, so its greatest end is always there
+  while (node != nullptr && ends_after(*node->aggregate)) {
+    if (!Walk(node->left, ends_after, starts_before, visit)) return false;
+    // every later start is at least this one
+    if (!starts_before(node->key.first.first)) return false;
+    if (ends_after(node->key.first.second) && !visit(node)) return false;
+    node = node->right;
+  }
+  return true;
+}
+}  // namespace s21
@@ -1,6 +1,9 @@
 #ifndef AVL_ITERATOR_H_
 #define AVL_ITERATOR_H_
 
+#include <cstddef>
+#include <iterator>
+
 #include "../avlTree/s21_avl_tree.tpp"
 
 namespace s21 {
@@ -9,21 +12,49 @@ template <typename T, typename V>
 class Iterator {
  public:
   using key_type = T;
+  using value_type = T;
   using reference = T&;
   using const_reference = const reference;
   using pointer = T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
 
-  Iterator(Node<T, V>* node = nullptr) : node_(node) {}
-  Iterator(Node<T, V>* nil, Node<T, V>* root) : node_(nil), root_(root) {}
+  Iterator(Node<T, V>* node = nullptr) : node_(node), header_(nullptr) {}
+  // An end() that knows its tree's header can be decremented and jumped
+  // back from; the header of an iterator on a node is only passed on to
+  // the end() it may reach
+  Iterator(Node<T, V>* node, const TreeHeader<T, V>* header)
+      : node_(node), header_(header) {}
   Iterator(const Iterator&) = default;
   Iterator& operator=(const Iterator&) = default;
   ~Iterator() = default;
-  Iterator operator+(const size_t value) {
-    Iterator tmp = *this;
-    for (size_t i = 0; i < value; i++) {
-      ++tmp;
+  // Jumps and distances go through the subtree sizes in Node::size_, so
+  // they cost O(log n) whatever the offset. Moving past either end of the
+  // container gives end().
+  Iterator operator+(const size_t value) const {
+    return Advance(static_cast<difference_type>(value));
+  }
+  Iterator operator-(const size_t value) const {
+    return Advance(-static_cast<difference_type>(value));
+  }
+  Iterator& operator+=(const size_t value) { return *this = *this + value; }
+  Iterator& operator-=(const size_t value) { return *this = *this - value; }
+  difference_type operator-(const Iterator& other) const {
+    return static_cast<difference_type>(Rank()) -
+           static_cast<difference_type>(other.Rank());
+  }
+  // Position in the container, size() for end()
+  size_t Rank() const {
+    if (node_ == nullptr) {
+      return Size(Root());
     }
-    return tmp;
+    size_t rank = Size(node_->left);
+    for (Node<T, V>* node = node_; node->parent; node = node->parent) {
+      if (node->parent->right == node) {
+        rank += Size(node->parent->left) + 1;
+      }
+    }
+    return rank;
   }
   Iterator& operator++() {
     if (node_ != nullptr) {
@@ -51,11 +82,10 @@ class Iterator {
     return tmp;
   }
   Iterator& operator--() {
-    if (Size(root_) > 0) {
-      if (node_ != nullptr) {
-        return OperatorHelper();
+    if (node_ == nullptr) {
+      if (header_ != nullptr) {
+        node_ = header_->rightmost;
       }
-      node_ = MaximumKey(root_);
       return *this;
     }
     return OperatorHelper();
@@ -78,21 +108,13 @@ class Iterator {
     return node_->key;
   }
   pointer operator->() const { return &(node_->key); }
-  int Size(Node<T, V>* node) {
+  Node<T, V>* GetNode() const { return node_; }
+  size_t Size(Node<T, V>* node) const {
     if (node) {
       return node->size_;
     }
     return 0;
   }
-  Node<T, V>* MaximumKey(Node<T, V>* node) {
-    if (node != nullptr) {
-      while (node->right != nullptr) {
-        return this->MaximumKey(node->right);
-      }
-      return node;
-    }
-    return nullptr;
-  }
   Iterator& OperatorHelper() {
     if (node_ != nullptr) {
       if (node_->left != nullptr) {
@@ -115,9 +137,44 @@ class Iterator {
 
  protected:
   Node<T, V>* node_;
-  Node<T, V>* root_;
+  const TreeHeader<T, V>* header_;
+
+  // Climbs from node_ like Rank(), so that the root is right even after
+  // swap or merge moved the node to another tree; only end() goes
+  // through the header
+  Node<T, V>* Root() const {
+    if (node_ == nullptr) {
+      return header_ != nullptr ? header_->root : nullptr;
+    }
+    Node<T, V>* node = node_;
+    while (node->parent) node = node->parent;
+    return node;
+  }
+  Iterator Advance(difference_type offset) const {
+    Node<T, V>* node = Root();
+    size_t k = Rank() + static_cast<size_t>(offset);
+    if (k >= Size(node)) {
+      return Iterator(nullptr, header_);
+    }
+    while (k != Size(node->left)) {
+      if (k < Size(node->left)) {
+        node = node->left;
+      } else {
+        k -= Size(node->left) + 1;
+        node = node->right;
+      }
+    }
+    return Iterator(node, header_);
+  }
 };
 
+// Number of increments from first to last in O(log n)
+template <typename T, typename V>
+typename Iterator<T, V>::difference_type distance(const Iterator<T, V>& first,
+                                                  const Iterator<T, V>& last) {
+  return last - first;
+}
+
 template <typename T, typename V>
 class ConstIterator : public Iterator<const T, const V> {
  public:
@@ -129,6 +186,20 @@ class ConstIterator : public Iterator<const T, const V> {
   using typename Iterator<const T, const V>::pointer;
 };
 
+
+// A pair of iterators that range-based for loops can walk over
+template <typename It>
+class IteratorRange {
+ public:
+  IteratorRange(It first, It last) : first_(first), last_(last) {}
+  It begin() const { return first_; }
+  It end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  It first_;
+  It last_;
+};
 }  // namespace s21
 
 #endif  // AVL_ITERATOR_H_
\ No newline at end of file
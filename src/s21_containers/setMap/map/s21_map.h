@@ -2,34 +2,66 @@
 #define AVL_MAP_H_
 
 #include <limits>
+#include <tuple>
 
+#include "../../vector/s21_vector.tpp"
 #include "../iterators/s21_iterator.h"
 
 namespace s21 {
-template <typename T, typename V>
+// V may be Augmented<mapped type, Policy>, see augmented_map below
+template <typename T, typename V, typename Compare = std::less<T>>
 class map {
  public:
   using key_type = T;
-  using mapped_type = V;
+  using mapped_type = typename AugmentTraits<V>::mapped_type;
   using default_value = mapped_type&;
   using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
   using iterator = Iterator<value_type, V>;
   using const_iterator = ConstIterator<value_type, V>;
   using size_type = size_t;
+  using reverse_iterator = std::reverse_iterator<iterator>;
   using Allocator = std::allocator<T>;
+  using node_type = NodeHandle<value_type, V>;
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
+  class value_compare {
+   public:
+    explicit value_compare(const Compare& comp = Compare()) : comp_(comp) {}
+    bool operator()(const value_type& a, const value_type& b) const {
+      return comp_(a.first, b.first);
+    }
+
+   private:
+    Compare comp_;
+  };
+  // The tree orders and searches by .first only
+  using tree_type = AVLTree<value_type, V, Compare, SelectFirst<value_type>>;
 
   map();
+  explicit map(const Compare& comp);
   map(std::initializer_list<value_type> const& items);
+  // Builds in O(n) from input sorted by key, O(n log n) otherwise
+  template <typename InputIt>
+  map(InputIt first, InputIt last);
   map(const map& m);
   map(map&& m) = default;
-  map<T, V> operator=(map&& m);
+  map<T, V, Compare> operator=(map&& m);
   ~map();
 
   mapped_type& at(const T& key);
   mapped_type& operator[](const T& key);
+  mapped_type& operator[](T&& key);
 
+  // O(1): the tree keeps its leftmost and rightmost nodes
   iterator begin();
   iterator end();
+  reverse_iterator rbegin();
+  reverse_iterator rend();
 
   bool empty();
   size_type size();
@@ -38,23 +70,93 @@ class map {
   void clear();
 
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // Amortized O(1) when value belongs right next to hint
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  // Construct the element once, directly inside its node
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  // Look the key up first and construct the mapped value from args only
+  // when the key is absent; args are left untouched otherwise
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
   std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
-  std::pair<iterator, bool> insert_or_assign(const key_type& key,
-                                             const mapped_type& obj);
+  // One descent: assigns obj to an existing key or inserts a new element
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj);
   void erase(iterator pos);
+  // Node handles: move elements between maps without allocating or
+  // copying. An empty handle is returned when key is absent.
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
+  insert_return_type insert(node_type&& node);
   void swap(map& other);
+  // Relinks the nodes of other whose keys are not here yet, no allocation
+  // or copies; elements with a key already present stay in other
   void merge(map& other);
+  // Set algebra by key in O(m log(n / m + 1)); other is consumed and left
+  // empty. Where both maps hold a key, the value of this map is kept.
+  void set_union(map& other);
+  void set_intersection(map& other);
+  void set_difference(map& other);
+  // Keeps the keys less than key and returns the others, O(log n)
+  map split(const T& key);
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
   bool contains(const T& key);
-  const AVLTree<value_type, V>& get_tree() const;
+  iterator find(const T& key);
+  // Finger search: starts at finger, cheap when key is close to it
+  iterator find(iterator finger, const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Elements with lo <= key < hi: O(log n) to position, then O(1) per step
+  IteratorRange<iterator> range(const T& lo, const T& hi);
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+
+  size_type rank(const T& key);
+  iterator select(size_type k);
+  iterator nth(size_type k);
+  size_type count_less(const T& key);
+
+  // Augmented maps only: Policy's aggregate over the values with keys in
+  // [lo, hi), or over the whole map, in O(log n). Values changed through a
+  // reference must be followed by refresh(it); insert_or_assign and
+  // erase keep the aggregates up to date by themselves.
+  auto aggregate(const T& lo, const T& hi) const;
+  auto aggregate() const;
+  void refresh(iterator pos);
+
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+  const tree_type& get_tree() const;
 
  private:
-  AVLTree<value_type, V> tree_;
+  tree_type tree_;
   Allocator allocator;
 
   mapped_type& operatorHelper(const T& key, int flag);
-  bool check_duplicates(const value_type& value);
+  iterator MakeIterator(Node<value_type, V>* node) const;
 };
 
+// map keeping Policy's aggregate of its values, e.g.
+// augmented_map<int, long, SumAggregate<long>> for range sums
+template <typename K, typename V, typename Policy,
+          typename Compare = std::less<K>>
+using augmented_map = map<K, Augmented<V, Policy>, Compare>;
 }  // namespace s21
 
 #endif  // AVL_MAP_H_
\ No newline at end of file
@@ -1,93 +1,131 @@
+#ifndef MAP_TPP
+#define MAP_TPP
 #include "s21_map.h"
 namespace s21 {
-template <typename T, typename V>
-map<T, V>::map() : tree_() {}
-template <typename T, typename V>
-map<T, V>::map(
-    std::initializer_list<typename map<T, V>::value_type> const& items) {
-  for (auto i = items.begin(); i != items.end(); ++i) {
-    this->insert(*i);
-  }
+template <typename T, typename V, typename Compare>
+map<T, V, Compare>::map() : tree_() {}
+template <typename T, typename V, typename Compare>
+map<T, V, Compare>::map(const Compare& comp) : tree_(comp) {}
+template <typename T, typename V, typename Compare>
+map<T, V, Compare>::map(
+    std::initializer_list<typename map<T, V, Compare>::value_type> const&
+        items)
+    : map(items.begin(), items.end()) {}
+template <typename T, typename V, typename Compare>
+template <typename InputIt>
+map<T, V, Compare>::map(InputIt first, InputIt last) : tree_() {
+  tree_.InsertMany(std::vector<value_type>(first, last));
 }
-template <typename T, typename V>
-map<T, V>::map(const map& m) : tree_(m.get_tree()) {}
-template <typename T, typename V>
-map<T, V> map<T, V>::operator=(map<T, V>&& m) {
+template <typename T, typename V, typename Compare>
+map<T, V, Compare>::map(const map& m) : tree_(m.get_tree()) {}
+template <typename T, typename V, typename Compare>
+map<T, V, Compare> map<T, V, Compare>::operator=(map<T, V, Compare>&& m) {
   if (this != &m) {
     tree_ = std::move(m.tree_);
   }
   return *this;
 }
-template <typename T, typename V>
-map<T, V>::~map() {}
+template <typename T, typename V, typename Compare>
+map<T, V, Compare>::~map() {}
 
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
-    const value_type& value) {
-  std::pair<typename map<T, V>::iterator, bool> result;
-  if (check_duplicates(value)) {
-    auto res = this->tree_.Search(value);
-    return std::make_pair(iterator(res), false);
-  }
-  this->tree_.Insert(value);
-  auto res = this->tree_.Search(value);
-  if (this->tree_.GetInserted()) {
-    result = std::make_pair(iterator(res), true);
-  } else {
-    result = std::make_pair(iterator(res), false);
+template <typename T, typename V, typename Compare>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::insert(const value_type& value) {
+  auto res = this->tree_.Insert(value);
+  return std::make_pair(MakeIterator(res), this->tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::insert(value_type&& value) {
+  Node<value_type, V>* node = tree_.Insert(std::move(value));
+  return std::make_pair(MakeIterator(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::insert(const key_type& key, const mapped_type& obj) {
+  Node<value_type, V>* node = tree_.TryEmplace(key, key, obj);
+  return std::make_pair(MakeIterator(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::emplace(Args&&... args) {
+  Node<value_type, V>* node = tree_.Emplace(std::forward<Args>(args)...);
+  return std::make_pair(MakeIterator(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::try_emplace(const key_type& key, Args&&... args) {
+  Node<value_type, V>* node = tree_.TryEmplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(MakeIterator(node), tree_.GetInserted());
+}
+// key is only moved from once the descent has found its slot
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::try_emplace(key_type&& key, Args&&... args) {
+  Node<value_type, V>* node = tree_.TryEmplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(MakeIterator(node), tree_.GetInserted());
+}
+template <typename T, typename V, typename Compare>
+template <typename M>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::insert_or_assign(const key_type& key, M&& obj) {
+  auto result = try_emplace(key, std::forward<M>(obj));
+  if (!result.second) {
+    result.first->second = std::forward<M>(obj);
+    tree_.Refresh(result.first.GetNode());
   }
   return result;
 }
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
-    const key_type& key, const mapped_type& obj) {
-  return insert(std::pair<key_type, mapped_type>(key, obj));
-}
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert_or_assign(
-    const key_type& key, const mapped_type& obj) {
-  if (this->empty()) {
-    return insert(std::make_pair(key, obj));
-  } else {
-    iterator i = this->begin();
-    for (; i != this->end(); ++i) {
-      if (i->first == key) {
-        i->second = obj;
-        return std::make_pair(i, false);
-      }
-    }
-    return insert(std::make_pair(key, obj));
+template <typename T, typename V, typename Compare>
+template <typename M>
+std::pair<typename map<T, V, Compare>::iterator, bool>
+map<T, V, Compare>::insert_or_assign(key_type&& key, M&& obj) {
+  auto result = try_emplace(std::move(key), std::forward<M>(obj));
+  if (!result.second) {
+    result.first->second = std::forward<M>(obj);
+    tree_.Refresh(result.first.GetNode());
   }
+  return result;
 }
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::at(const T& key) {
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::mapped_type& map<T, V, Compare>::at(const T& key) {
   return operatorHelper(key, 0);
 }
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::operator[](const T& key) {
-  return operatorHelper(key, 1);
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::mapped_type& map<T, V, Compare>::operator[](
+    const T& key) {
+  return try_emplace(key).first->second;
 }
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::begin() {
-  Node<value_type, V>* node = tree_.GetRoot();
-  if (node == nullptr) {
-    return iterator(nullptr);
-  }
-  while (node->left != nullptr && !node->left->isSentinel) {
-    node = node->left;
-  }
-  if (node->isSentinel) {
-    return iterator(nullptr);
-  } else {
-    return iterator(node);
-  }
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::mapped_type& map<T, V, Compare>::operator[](
+    T&& key) {
+  return try_emplace(std::move(key)).first->second;
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::begin() {
+  return MakeIterator(tree_.GetHeader()->leftmost);
 }
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::end() {
-  return iterator(nullptr, tree_.GetRoot());
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::end() {
+  return MakeIterator(nullptr);
 }
-template <typename T, typename V>
-bool map<T, V>::empty() {
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::reverse_iterator map<T, V, Compare>::rbegin() {
+  return reverse_iterator(end());
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::reverse_iterator map<T, V, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+template <typename T, typename V, typename Compare>
+bool map<T, V, Compare>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -96,84 +134,225 @@ bool map<T, V>::empty() {
   }
   return false;
 }
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::size() {
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::size_type map<T, V, Compare>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
   return tree_.GetRoot()->size_;
 }
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::max_size() {
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::size_type map<T, V, Compare>::max_size() {
   return allocator.max_size() / 10;
 }
-template <typename T, typename V>
-void map<T, V>::clear() {
-  if (this->get_tree().GetRoot()) {
-    for (iterator i = this->begin(); i != this->end(); i++) {
-      this->erase(i);
-    }
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::clear() {
+  if (this->tree_.GetRoot()) {
+    this->tree_.Clear(this->tree_.GetRoot());
   }
 }
-template <typename T, typename V>
-void map<T, V>::erase(typename map<T, V>::iterator pos) {
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::erase(typename map<T, V, Compare>::iterator pos) {
   if (pos != nullptr) {
-    this->tree_.Remove(*pos);
+    this->tree_.Remove(pos.GetNode());
   }
 }
-template <typename T, typename V>
-void map<T, V>::swap(map& other) {
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::node_type map<T, V, Compare>::extract(
+    iterator pos) {
+  return tree_.Extract(pos.GetNode());
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::node_type map<T, V, Compare>::extract(
+    const T& key) {
+  return tree_.Extract(tree_.Search(key));
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::insert_return_type map<T, V, Compare>::insert(
+    node_type&& node) {
+  Node<value_type, V>* found = tree_.Insert(std::move(node));
+  bool inserted = tree_.GetInserted();
+  return {MakeIterator(found), inserted,
+          inserted ? node_type() : std::move(node)};
+}
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::swap(map& other) {
   tree_.Swap(other.tree_);
 }
-template <typename T, typename V>
-void map<T, V>::merge(map& other) {
-  std::pair<typename map<T, V>::iterator, bool> result;
-  iterator iter = other.begin();
-  while (iter != other.end()) {
-    result = this->insert(*iter);
-    // if (result.second) other.erase(iter);
-    iter++;
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::merge(map& other) {
+  tree_.Merge(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::set_union(map& other) {
+  tree_.Union(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::set_intersection(map& other) {
+  tree_.Intersection(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::set_difference(map& other) {
+  tree_.Difference(other.tree_);
+}
+template <typename T, typename V, typename Compare>
+map<T, V, Compare> map<T, V, Compare>::split(const T& key) {
+  map<T, V, Compare> result(key_comp());
+  tree_.Split(key, result.tree_);
+  return result;
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename map<T, V, Compare>::iterator, bool>>
+map<T, V, Compare>::insert_many(Args&&... args) {
+  std::vector<value_type> values;
+  values.reserve(sizeof...(args));
+  (values.emplace_back(std::forward<Args>(args)), ...);
+  auto nodes = tree_.InsertMany(std::move(values));
+  s21::vector<std::pair<iterator, bool>> result;
+  result.reserve(nodes.size());
+  for (const auto& node : nodes) {
+    result.push_back(std::make_pair(MakeIterator(node.first), node.second));
+  }
+  return result;
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::insert(
+    iterator hint, const value_type& value) {
+  return MakeIterator(tree_.Insert(hint.GetNode(), value));
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::insert(
+    iterator hint, value_type&& value) {
+  return MakeIterator(tree_.Insert(hint.GetNode(), std::move(value)));
+}
+template <typename T, typename V, typename Compare>
+template <typename... Args>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::emplace_hint(
+    iterator hint, Args&&... args) {
+  return MakeIterator(
+      tree_.EmplaceHint(hint.GetNode(), std::forward<Args>(args)...));
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::find(
+    iterator finger, const T& key) {
+  return MakeIterator(tree_.FingerSearch(finger.GetNode(), key));
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::lower_bound(
+    const T& key) {
+  Node<value_type, V>* node = tree_.LowerBound(key);
+  return MakeIterator(node);
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::upper_bound(
+    const T& key) {
+  Node<value_type, V>* node = tree_.UpperBound(key);
+  return MakeIterator(node);
+}
+template <typename T, typename V, typename Compare>
+std::pair<typename map<T, V, Compare>::iterator,
+          typename map<T, V, Compare>::iterator>
+map<T, V, Compare>::equal_range(const T& key) {
+  iterator first = lower_bound(key);
+  if (first == end() || tree_.GetCompare()(key, first.GetNode()->key.first)) {
+    return std::make_pair(first, first);
   }
+  iterator last = first;
+  return std::make_pair(first, ++last);
 }
-template <typename T, typename V>
-bool map<T, V>::contains(const T& key) {
-  for (iterator i = this->begin(); i != this->end(); i++) {
-    if (i->first == key) return true;
+template <typename T, typename V, typename Compare>
+IteratorRange<typename map<T, V, Compare>::iterator> map<T, V, Compare>::range(
+    const T& lo, const T& hi) {
+  if (!tree_.GetCompare()(lo, hi)) {
+    return IteratorRange<iterator>(end(), end());
   }
-  return false;
+  return IteratorRange<iterator>(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename V, typename Compare>
+bool map<T, V, Compare>::contains(const T& key) {
+  return tree_.Search(key) != nullptr;
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::find(const T& key) {
+  return MakeIterator(tree_.Search(key));
+}
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+bool map<T, V, Compare>::contains(const K& key) {
+  return tree_.Search(key) != nullptr;
 }
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::operatorHelper(const T& key,
-                                                           int flag) {
-  iterator i = this->begin();
-  if (i != nullptr) {
-    for (; i != this->end(); i++) {
-      if (i->first == key) {
-        return i->second;
-      }
-    }
-    if (flag) {
-      auto res = insert(value_type(key, mapped_type()));
-      return res.first->second;
-    } else {
-      throw std::invalid_argument("This key doesn't exist");
-    }
+template <typename T, typename V, typename Compare>
+template <typename K, typename C, typename>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::find(const K& key) {
+  return MakeIterator(tree_.Search(key));
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::mapped_type&
+map<T, V, Compare>::operatorHelper(const T& key, int flag) {
+  Node<value_type, V>* node = tree_.Search(key);
+  if (node != nullptr) {
+    return node->key.second;
+  }
+  if (!flag) {
+    throw std::invalid_argument("This key doesn't exist");
   }
-  static mapped_type default_value;
-  return default_value;
+  return try_emplace(key).first->second;
 }
-template <typename T, typename V>
-const AVLTree<typename map<T, V>::value_type, V>& map<T, V>::get_tree() const {
-  return tree_;
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::size_type map<T, V, Compare>::rank(const T& key) {
+  if (!contains(key)) {
+    return size();
+  }
+  return tree_.CountLess(key);
 }
-template <typename T, typename V>
-bool map<T, V>::check_duplicates(const value_type& value) {
-  auto i = this->begin();
-  for (; i != this->end(); i++) {
-    if (i->first == value.first) {
-      return true;
-    }
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::select(size_type k) {
+  Node<value_type, V>* node = tree_.Select(k);
+  if (node == nullptr) {
+    return end();
   }
-  return false;
+  return MakeIterator(node);
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::nth(size_type k) {
+  return select(k);
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::size_type map<T, V, Compare>::count_less(
+    const T& key) {
+  return tree_.CountLess(key);
+}
+template <typename T, typename V, typename Compare>
+auto map<T, V, Compare>::aggregate(const T& lo, const T& hi) const {
+  return tree_.Aggregate(lo, hi);
+}
+template <typename T, typename V, typename Compare>
+auto map<T, V, Compare>::aggregate() const {
+  return tree_.Aggregate();
+}
+template <typename T, typename V, typename Compare>
+void map<T, V, Compare>::refresh(iterator pos) {
+  tree_.Refresh(pos.GetNode());
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::key_compare map<T, V, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::value_compare map<T, V, Compare>::value_comp()
+    const {
+  return value_compare(tree_.GetCompare());
+}
+template <typename T, typename V, typename Compare>
+const typename map<T, V, Compare>::tree_type& map<T, V, Compare>::get_tree()
+    const {
+  return tree_;
+}
+template <typename T, typename V, typename Compare>
+typename map<T, V, Compare>::iterator map<T, V, Compare>::MakeIterator(
+    Node<value_type, V>* node) const {
+  return iterator(node, tree_.GetHeader());
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
+#endif  // MAP_TPP
@@ -0,0 +1,89 @@
+#ifndef AVL_MULTISET_H_
+#define AVL_MULTISET_H_
+
+#include <algorithm>
+
+#include "../../vector/s21_vector.tpp"
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Ordered container with repeated keys on the AVL engine. Equal keys keep
+// their insertion order. count and equal_range cost O(log n) whatever the
+// number of copies, through the subtree sizes of the tree.
+template <typename T, typename Compare = std::less<T>>
+class multiset {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using iterator = Iterator<T, T>;
+  using const_iterator = ConstIterator<T, T>;
+  using size_type = size_t;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using Allocator = std::allocator<T>;
+  using node_type = NodeHandle<T, T>;
+
+  multiset();
+  explicit multiset(const Compare& comp);
+  multiset(std::initializer_list<value_type> const& items);
+  // O(n) for sorted input, O(n log n) otherwise
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last);
+  multiset(const multiset& ms);
+  multiset(multiset&& ms) = default;
+  multiset& operator=(multiset&& ms);
+  ~multiset() {}
+
+  iterator begin();
+  iterator end();
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+
+  void clear();
+  // O(log n); a key not less than the current maximum skips the descent
+  iterator insert(const T& value);
+  iterator insert(T&& value);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  void erase(iterator pos);
+  // Removes all copies of key at once: O(log n + k) for k copies
+  size_type erase(const T& key);
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
+  iterator insert(node_type&& node);
+  void swap(multiset& other);
+  // Relinks every element of other into this multiset, other ends empty
+  void merge(multiset& other);
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+  size_type count(const T& key);
+  // find returns the first of the equal keys
+  iterator find(const T& key);
+  bool contains(const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+
+  size_type count_less(const T& key);
+  iterator select(size_type k);
+  iterator nth(size_type k);
+
+  key_compare key_comp() const;
+  const AVLTree<T, T, Compare>& get_tree() const;
+
+ private:
+  AVLTree<T, T, Compare> tree_;
+  Allocator allocator;
+
+  iterator MakeIterator(Node<T, T>* node) const;
+};
+}  // namespace s21
+
+#endif  // AVL_MULTISET_H_
@@ -0,0 +1,191 @@
+#include "./s21_multiset.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset() : tree_() {}
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(const Compare& comp) : tree_(comp) {}
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(std::initializer_list<value_type> const& items)
+    : multiset(items.begin(), items.end()) {}
+template <typename T, typename Compare>
+template <typename InputIt>
+multiset<T, Compare>::multiset(InputIt first, InputIt last) : tree_() {
+  std::vector<value_type> values(first, last);
+  if (!std::is_sorted(values.begin(), values.end(), tree_.GetCompare())) {
+    std::stable_sort(values.begin(), values.end(), tree_.GetCompare());
+  }
+  tree_.Assign_multiset(std::move(values));
+}
+template <typename T, typename Compare>
+multiset<T, Compare>::multiset(const multiset& ms) : tree_(ms.get_tree()) {}
+template <typename T, typename Compare>
+multiset<T, Compare>& multiset<T, Compare>::operator=(multiset&& ms) {
+  if (this != &ms) {
+    tree_ = std::move(ms.tree_);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::begin() {
+  return MakeIterator(tree_.GetHeader()->leftmost);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::end() {
+  return MakeIterator(nullptr);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::reverse_iterator multiset<T, Compare>::rbegin() {
+  return reverse_iterator(end());
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::reverse_iterator multiset<T, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+template <typename T, typename Compare>
+bool multiset<T, Compare>::empty() {
+  return tree_.GetRoot() == nullptr;
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::size() {
+  if (tree_.GetRoot() == nullptr) {
+    return 0;
+  }
+  return tree_.GetRoot()->size_;
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::max_size() {
+  return allocator.max_size() / 10;
+}
+template <typename T, typename Compare>
+void multiset<T, Compare>::clear() {
+  if (tree_.GetRoot()) {
+    tree_.Clear(tree_.GetRoot());
+    tree_.SetRoot(nullptr);
+  }
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::insert(
+    const T& value) {
+  return MakeIterator(tree_.Insert_multiset(value));
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::insert(
+    T&& value) {
+  return MakeIterator(tree_.Insert_multiset(std::move(value)));
+}
+template <typename T, typename Compare>
+template <typename... Args>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::emplace(
+    Args&&... args) {
+  return MakeIterator(tree_.Emplace_multiset(std::forward<Args>(args)...));
+}
+template <typename T, typename Compare>
+void multiset<T, Compare>::erase(iterator pos) {
+  if (pos != nullptr) {
+    tree_.Remove(pos.GetNode());
+  }
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::erase(
+    const T& key) {
+  return tree_.RemoveAll(key);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::node_type multiset<T, Compare>::extract(
+    iterator pos) {
+  return tree_.Extract(pos.GetNode());
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::node_type multiset<T, Compare>::extract(
+    const T& key) {
+  return extract(find(key));
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::insert(
+    node_type&& node) {
+  return MakeIterator(tree_.Insert_multiset(std::move(node)));
+}
+template <typename T, typename Compare>
+void multiset<T, Compare>::swap(multiset& other) {
+  tree_.Swap(other.tree_);
+}
+template <typename T, typename Compare>
+void multiset<T, Compare>::merge(multiset& other) {
+  tree_.Merge_multiset(other.tree_);
+}
+template <typename T, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename multiset<T, Compare>::iterator, bool>>
+multiset<T, Compare>::insert_many(Args&&... args) {
+  s21::vector<std::pair<iterator, bool>> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(std::make_pair(insert(std::forward<Args>(args)), true)),
+   ...);
+  return result;
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::count(
+    const T& key) {
+  return tree_.Count(key);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::find(
+    const T& key) {
+  Node<T, T>* node = tree_.LowerBound(key);
+  if (node == nullptr || tree_.GetCompare()(key, node->key)) {
+    return end();
+  }
+  return MakeIterator(node);
+}
+template <typename T, typename Compare>
+bool multiset<T, Compare>::contains(const T& key) {
+  return tree_.Search(key) != nullptr;
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::lower_bound(
+    const T& key) {
+  return MakeIterator(tree_.LowerBound(key));
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::upper_bound(
+    const T& key) {
+  return MakeIterator(tree_.UpperBound(key));
+}
+template <typename T, typename Compare>
+std::pair<typename multiset<T, Compare>::iterator,
+          typename multiset<T, Compare>::iterator>
+multiset<T, Compare>::equal_range(const T& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::size_type multiset<T, Compare>::count_less(
+    const T& key) {
+  return tree_.CountLess(key);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::select(
+    size_type k) {
+  return MakeIterator(tree_.Select(k));
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::nth(
+    size_type k) {
+  return select(k);
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::key_compare multiset<T, Compare>::key_comp()
+    const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const AVLTree<T, T, Compare>& multiset<T, Compare>::get_tree() const {
+  return tree_;
+}
+template <typename T, typename Compare>
+typename multiset<T, Compare>::iterator multiset<T, Compare>::MakeIterator(
+    Node<T, T>* node) const {
+  return iterator(node, tree_.GetHeader());
+}
+}  // namespace s21
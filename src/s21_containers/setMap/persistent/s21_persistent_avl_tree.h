@@ -0,0 +1,77 @@
+#ifndef SRC_PERSISTENT_AVL_H_
+#define SRC_PERSISTENT_AVL_H_
+
+#include <memory>
+
+#include "../avlTree/s21_avl_tree.h"
+
+namespace s21 {
+// Persistent AVL tree: nodes are immutable once linked and shared between
+// versions, and an update copies only the O(log n) nodes on its root path.
+// Copying the tree is O(1) and gives a snapshot that later updates never
+// touch. Elements are held by shared_ptr too, so path copies do not copy
+// them. There are no parent links; iterators keep their own stack.
+//
+// One writer may update a tree while other threads copy it: the root is
+// read and published with the atomic shared_ptr operations, and each copy
+// can then be read by its thread without locks.
+template <typename T, typename Compare = std::less<T>,
+          typename KeyOfValue = Identity<T>>
+class PersistentAVLTree {
+ public:
+  struct PNode {
+    std::shared_ptr<const T> value;
+    std::shared_ptr<const PNode> left;
+    std::shared_ptr<const PNode> right;
+    int height;
+    size_t size;
+  };
+  using NodePtr = std::shared_ptr<const PNode>;
+
+  PersistentAVLTree();
+  explicit PersistentAVLTree(const Compare& comp);
+  PersistentAVLTree(const PersistentAVLTree& other);
+  PersistentAVLTree(PersistentAVLTree&& other) noexcept;
+  PersistentAVLTree& operator=(const PersistentAVLTree& other);
+  PersistentAVLTree& operator=(PersistentAVLTree&& other) noexcept;
+  ~PersistentAVLTree() = default;
+
+  // The current version; safe to call while another thread updates
+  NodePtr Root() const;
+  // Insert keeps an equal element, Assign replaces it. Both return whether
+  // the key was new; nothing is copied when the tree does not change.
+  template <typename U>
+  bool Insert(U&& value);
+  template <typename U>
+  bool Assign(U&& value);
+  template <typename K>
+  bool Remove(const K& key);
+  template <typename K>
+  const T* Search(const K& key) const;
+  size_t Size() const;
+  void Clear();
+  const Compare& GetCompare() const;
+  const KeyOfValue& GetKeyOfValue() const;
+
+ private:
+  NodePtr root_;
+  Compare comp_;
+  KeyOfValue key_of_;
+
+  static int Height(const NodePtr& node);
+  static size_t Size(const NodePtr& node);
+  static NodePtr Make(std::shared_ptr<const T> value, NodePtr left,
+                      NodePtr right);
+  static NodePtr Balance(std::shared_ptr<const T> value, NodePtr left,
+                         NodePtr right);
+  static NodePtr RemoveMin(const NodePtr& node,
+                           std::shared_ptr<const T>& min);
+  template <typename U>
+  NodePtr InsertAt(const NodePtr& node, U&& value, bool assign, bool& added);
+  template <typename K>
+  NodePtr RemoveAt(const NodePtr& node, const K& key, bool& removed);
+  void Publish(NodePtr root);
+};
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_AVL_H_
@@ -0,0 +1,219 @@
+#ifndef SRC_PERSISTENT_AVL_TPP_
+#define SRC_PERSISTENT_AVL_TPP_
+
+#include "s21_persistent_avl_tree.h"
+
+namespace s21 {
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>::PersistentAVLTree()
+    : root_(), comp_(), key_of_() {}
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>::PersistentAVLTree(
+    const Compare& comp)
+    : root_(), comp_(comp), key_of_() {}
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>::PersistentAVLTree(
+    const PersistentAVLTree& other)
+    : root_(other.Root()), comp_(other.comp_), key_of_(other.key_of_) {}
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>::PersistentAVLTree(
+    PersistentAVLTree&& other) noexcept
+    : root_(std::move(other.root_)),
+      comp_(std::move(other.comp_)),
+      key_of_(std::move(other.key_of_)) {}
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>&
+PersistentAVLTree<T, Compare, KeyOfValue>::operator=(
+    const PersistentAVLTree& other) {
+  if (this != &other) {
+    comp_ = other.comp_;
+    Publish(other.Root());
+  }
+  return *this;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+PersistentAVLTree<T, Compare, KeyOfValue>&
+PersistentAVLTree<T, Compare, KeyOfValue>::operator=(
+    PersistentAVLTree&& other) noexcept {
+  if (this != &other) {
+    comp_ = std::move(other.comp_);
+    Publish(std::move(other.root_));
+  }
+  return *this;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::Root() const {
+  return std::atomic_load(&root_);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+bool PersistentAVLTree<T, Compare, KeyOfValue>::Insert(U&& value) {
+  bool added = false;
+  NodePtr root = InsertAt(root_, std::forward<U>(value), false, added);
+  if (root != root_) Publish(std::move(root));
+  return added;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+bool PersistentAVLTree<T, Compare, KeyOfValue>::Assign(U&& value) {
+  bool added = false;
+  Publish(InsertAt(root_, std::forward<U>(value), true, added));
+  return added;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+bool PersistentAVLTree<T, Compare, KeyOfValue>::Remove(const K& key) {
+  bool removed = false;
+  NodePtr root = RemoveAt(root_, key, removed);
+  if (removed) Publish(std::move(root));
+  return removed;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+const T* PersistentAVLTree<T, Compare, KeyOfValue>::Search(
+    const K& key) const {
+  const PNode* node = root_.get();
+  while (node != nullptr) {
+    if (comp_(key, key_of_(*node->value))) {
+      node = node->left.get();
+    } else if (comp_(key_of_(*node->value), key)) {
+      node = node->right.get();
+    } else {
+      return node->value.get();
+    }
+  }
+  return nullptr;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+size_t PersistentAVLTree<T, Compare, KeyOfValue>::Size() const {
+  return Size(root_);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void PersistentAVLTree<T, Compare, KeyOfValue>::Clear() {
+  Publish(nullptr);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const Compare& PersistentAVLTree<T, Compare, KeyOfValue>::GetCompare() const {
+  return comp_;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+const KeyOfValue& PersistentAVLTree<T, Compare, KeyOfValue>::GetKeyOfValue()
+    const {
+  return key_of_;
+}
+
+template <typename T, typename Compare, typename KeyOfValue>
+int PersistentAVLTree<T, Compare, KeyOfValue>::Height(const NodePtr& node) {
+  return node ? node->height : 0;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+size_t PersistentAVLTree<T, Compare, KeyOfValue>::Size(const NodePtr& node) {
+  return node ? node->size : 0;
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::Make(std::shared_ptr<const T> value,
+                                                NodePtr left, NodePtr right) {
+  int height = std::max(Height(left), Height(right)) + 1;
+  size_t size = Size(left) + Size(right) + 1;
+  return std::make_shared<const PNode>(PNode{
+      std::move(value), std::move(left), std::move(right), height, size});
+}
+// Builds a node over left and right whose heights differ by at most two,
+// rotating by building the new top nodes instead of relinking old ones
+template <typename T, typename Compare, typename KeyOfValue>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::Balance(
+    std::shared_ptr<const T> value, NodePtr left, NodePtr right) {
+  int hl = Height(left);
+  int hr = Height(right);
+  if (hl > hr + 1) {
+    if (Height(left->left) >= Height(left->right)) {
+      return Make(left->value, left->left,
+                  Make(std::move(value), left->right, std::move(right)));
+    }
+    const NodePtr& mid = left->right;
+    return Make(mid->value, Make(left->value, left->left, mid->left),
+                Make(std::move(value), mid->right, std::move(right)));
+  }
+  if (hr > hl + 1) {
+    if (Height(right->right) >= Height(right->left)) {
+      return Make(right->value,
+                  Make(std::move(value), std::move(left), right->left),
+                  right->right);
+    }
+    const NodePtr& mid = right->left;
+    return Make(mid->value, Make(std::move(value), std::move(left), mid->left),
+                Make(right->value, mid->right, right->right));
+  }
+  return Make(std::move(value), std::move(left), std::move(right));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::RemoveMin(
+    const NodePtr& node, std::shared_ptr<const T>& min) {
+  if (!node->left) {
+    min = node->value;
+    return node->right;
+  }
+  return Balance(node->value, RemoveMin(node->left, min), node->right);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename U>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::InsertAt(const NodePtr& node,
+                                                    U&& value, bool assign,
+                                                    bool& added) {
+  if (!node) {
+    added = true;
+    return Make(std::make_shared<const T>(std::forward<U>(value)), nullptr,
+                nullptr);
+  }
+  if (comp_(key_of_(value), key_of_(*node->value))) {
+    NodePtr left = InsertAt(node->left, std::forward<U>(value), assign, added);
+    if (left == node->left) return node;
+    return Balance(node->value, std::move(left), node->right);
+  }
+  if (comp_(key_of_(*node->value), key_of_(value))) {
+    NodePtr right =
+        InsertAt(node->right, std::forward<U>(value), assign, added);
+    if (right == node->right) return node;
+    return Balance(node->value, node->left, std::move(right));
+  }
+  if (!assign) return node;
+  return Make(std::make_shared<const T>(std::forward<U>(value)), node->left,
+              node->right);
+}
+template <typename T, typename Compare, typename KeyOfValue>
+template <typename K>
+typename PersistentAVLTree<T, Compare, KeyOfValue>::NodePtr
+PersistentAVLTree<T, Compare, KeyOfValue>::RemoveAt(const NodePtr& node,
+                                                    const K& key,
+                                                    bool& removed) {
+  if (!node) return node;
+  if (comp_(key, key_of_(*node->value))) {
+    NodePtr left = RemoveAt(node->left, key, removed);
+    if (!removed) return node;
+    return Balance(node->value, std::move(left), node->right);
+  }
+  if (comp_(key_of_(*node->value), key)) {
+    NodePtr right = RemoveAt(node->right, key, removed);
+    if (!removed) return node;
+    return Balance(node->value, node->left, std::move(right));
+  }
+  removed = true;
+  if (!node->left) return node->right;
+  if (!node->right) return node->left;
+  std::shared_ptr<const T> min;
+  NodePtr right = RemoveMin(node->right, min);
+  return Balance(std::move(min), node->left, std::move(right));
+}
+template <typename T, typename Compare, typename KeyOfValue>
+void PersistentAVLTree<T, Compare, KeyOfValue>::Publish(NodePtr root) {
+  std::atomic_store(&root_, std::move(root));
+}
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_AVL_TPP_
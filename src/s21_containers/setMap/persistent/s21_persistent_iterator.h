@@ -0,0 +1,81 @@
+#ifndef SRC_PERSISTENT_ITERATOR_H_
+#define SRC_PERSISTENT_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "s21_persistent_avl_tree.tpp"
+
+namespace s21 {
+// Forward iterator over one version of a PersistentAVLTree. It holds that
+// version's root, so it stays valid and keeps seeing the same elements
+// whatever the tree is updated to later. The stack holds the current node
+// on top and, below it, the ancestors still to be visited.
+template <typename Tree, typename T>
+class PersistentIterator {
+ public:
+  using value_type = T;
+  using reference = const T&;
+  using pointer = const T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+  using NodePtr = typename Tree::NodePtr;
+  using PNode = typename Tree::PNode;
+
+  PersistentIterator() = default;
+  // Positioned at the first element of root
+  explicit PersistentIterator(NodePtr root) : root_(std::move(root)) {
+    PushLeft(root_.get());
+  }
+  // Positioned at the first element whose key is not less than key
+  template <typename K>
+  PersistentIterator(NodePtr root, const Tree& tree, const K& key)
+      : root_(std::move(root)) {
+    const PNode* node = root_.get();
+    while (node != nullptr) {
+      const auto& node_key = tree.GetKeyOfValue()(*node->value);
+      if (tree.GetCompare()(node_key, key)) {
+        node = node->right.get();
+      } else {
+        stack_.push_back(node);
+        if (!tree.GetCompare()(key, node_key)) break;
+        node = node->left.get();
+      }
+    }
+  }
+
+  reference operator*() const { return *stack_.back()->value; }
+  pointer operator->() const { return stack_.back()->value.get(); }
+  PersistentIterator& operator++() {
+    const PNode* node = stack_.back();
+    stack_.pop_back();
+    PushLeft(node->right.get());
+    return *this;
+  }
+  PersistentIterator operator++(int) {
+    PersistentIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const PersistentIterator& other) const {
+    return Current() == other.Current();
+  }
+  bool operator!=(const PersistentIterator& other) const {
+    return Current() != other.Current();
+  }
+
+ private:
+  NodePtr root_;
+  std::vector<const PNode*> stack_;
+
+  const PNode* Current() const {
+    return stack_.empty() ? nullptr : stack_.back();
+  }
+  void PushLeft(const PNode* node) {
+    for (; node != nullptr; node = node->left.get()) stack_.push_back(node);
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_ITERATOR_H_
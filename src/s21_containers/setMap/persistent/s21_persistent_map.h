@@ -0,0 +1,64 @@
+#ifndef AVL_PERSISTENT_MAP_H_
+#define AVL_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_persistent_iterator.h"
+
+namespace s21 {
+// map with copy-on-write snapshots, see persistent_set. Values cannot be
+// changed in place, so there is no operator[]: use insert_or_assign.
+template <typename T, typename V, typename Compare = std::less<T>>
+class persistent_map {
+ public:
+  using key_type = T;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using tree_type =
+      PersistentAVLTree<value_type, Compare, SelectFirst<value_type>>;
+  using iterator = PersistentIterator<tree_type, value_type>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  persistent_map() = default;
+  explicit persistent_map(const Compare& comp);
+  persistent_map(std::initializer_list<value_type> const& items);
+  persistent_map(const persistent_map& m) = default;
+  persistent_map(persistent_map&& m) = default;
+  persistent_map& operator=(const persistent_map& m) = default;
+  persistent_map& operator=(persistent_map&& m) = default;
+  ~persistent_map() = default;
+
+  persistent_map snapshot() const;
+
+  const mapped_type& at(const T& key) const;
+
+  // Iterators walk the version current when they were made
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+
+  void clear();
+  bool insert(const value_type& value);
+  bool insert(const key_type& key, const mapped_type& obj);
+  // Returns whether the key was new
+  bool insert_or_assign(const key_type& key, const mapped_type& obj);
+  size_type erase(const T& key);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_PERSISTENT_MAP_H_
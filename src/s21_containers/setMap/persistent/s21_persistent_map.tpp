@@ -0,0 +1,96 @@
+#include "s21_persistent_map.h"
+
+namespace s21 {
+template <typename T, typename V, typename Compare>
+persistent_map<T, V, Compare>::persistent_map(const Compare& comp)
+    : tree_(comp) {}
+template <typename T, typename V, typename Compare>
+persistent_map<T, V, Compare>::persistent_map(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  for (const auto& item : items) insert(item);
+}
+template <typename T, typename V, typename Compare>
+persistent_map<T, V, Compare> persistent_map<T, V, Compare>::snapshot() const {
+  return *this;
+}
+template <typename T, typename V, typename Compare>
+const typename persistent_map<T, V, Compare>::mapped_type&
+persistent_map<T, V, Compare>::at(const T& key) const {
+  const value_type* value = tree_.Search(key);
+  if (value == nullptr) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return value->second;
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::iterator
+persistent_map<T, V, Compare>::begin() const {
+  return iterator(tree_.Root());
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::iterator
+persistent_map<T, V, Compare>::end() const {
+  return iterator();
+}
+template <typename T, typename V, typename Compare>
+bool persistent_map<T, V, Compare>::empty() const {
+  return tree_.Size() == 0;
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::size_type
+persistent_map<T, V, Compare>::size() const {
+  return tree_.Size();
+}
+template <typename T, typename V, typename Compare>
+void persistent_map<T, V, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename V, typename Compare>
+bool persistent_map<T, V, Compare>::insert(const value_type& value) {
+  return tree_.Insert(value);
+}
+template <typename T, typename V, typename Compare>
+bool persistent_map<T, V, Compare>::insert(const key_type& key,
+                                           const mapped_type& obj) {
+  return tree_.Insert(value_type(key, obj));
+}
+template <typename T, typename V, typename Compare>
+bool persistent_map<T, V, Compare>::insert_or_assign(const key_type& key,
+                                                     const mapped_type& obj) {
+  return tree_.Assign(value_type(key, obj));
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::size_type
+persistent_map<T, V, Compare>::erase(const T& key) {
+  return tree_.Remove(key) ? 1 : 0;
+}
+template <typename T, typename V, typename Compare>
+bool persistent_map<T, V, Compare>::contains(const T& key) const {
+  return tree_.Search(key) != nullptr;
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::iterator
+persistent_map<T, V, Compare>::find(const T& key) const {
+  iterator it = lower_bound(key);
+  if (it == end() || tree_.GetCompare()(key, it->first)) {
+    return end();
+  }
+  return it;
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::iterator
+persistent_map<T, V, Compare>::lower_bound(const T& key) const {
+  return iterator(tree_.Root(), tree_, key);
+}
+template <typename T, typename V, typename Compare>
+typename persistent_map<T, V, Compare>::key_compare
+persistent_map<T, V, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename V, typename Compare>
+const typename persistent_map<T, V, Compare>::tree_type&
+persistent_map<T, V, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
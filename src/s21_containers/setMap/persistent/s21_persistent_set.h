@@ -0,0 +1,59 @@
+#ifndef AVL_PERSISTENT_SET_H_
+#define AVL_PERSISTENT_SET_H_
+
+#include <initializer_list>
+
+#include "s21_persistent_iterator.h"
+
+namespace s21 {
+// set with copy-on-write snapshots: copying it or calling snapshot() is
+// O(1), and the copy never sees later updates. Each insert or erase copies
+// the O(log n) nodes on one root path. Elements are immutable. One thread
+// may update the set while others take snapshots of it and read them.
+template <typename T, typename Compare = std::less<T>>
+class persistent_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using key_compare = Compare;
+  using tree_type = PersistentAVLTree<T, Compare>;
+  using iterator = PersistentIterator<tree_type, T>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  persistent_set() = default;
+  explicit persistent_set(const Compare& comp);
+  persistent_set(std::initializer_list<value_type> const& items);
+  persistent_set(const persistent_set& s) = default;
+  persistent_set(persistent_set&& s) = default;
+  persistent_set& operator=(const persistent_set& s) = default;
+  persistent_set& operator=(persistent_set&& s) = default;
+  ~persistent_set() = default;
+
+  persistent_set snapshot() const;
+
+  // Iterators walk the version current when they were made
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+
+  void clear();
+  bool insert(const T& value);
+  bool insert(T&& value);
+  size_type erase(const T& key);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  iterator lower_bound(const T& key) const;
+
+  key_compare key_comp() const;
+  const tree_type& get_tree() const;
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // AVL_PERSISTENT_SET_H_
@@ -0,0 +1,81 @@
+#include "s21_persistent_set.h"
+
+namespace s21 {
+template <typename T, typename Compare>
+persistent_set<T, Compare>::persistent_set(const Compare& comp)
+    : tree_(comp) {}
+template <typename T, typename Compare>
+persistent_set<T, Compare>::persistent_set(
+    std::initializer_list<value_type> const& items)
+    : tree_() {
+  for (const auto& item : items) insert(item);
+}
+template <typename T, typename Compare>
+persistent_set<T, Compare> persistent_set<T, Compare>::snapshot() const {
+  return *this;
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::iterator
+persistent_set<T, Compare>::begin() const {
+  return iterator(tree_.Root());
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::iterator persistent_set<T, Compare>::end()
+    const {
+  return iterator();
+}
+template <typename T, typename Compare>
+bool persistent_set<T, Compare>::empty() const {
+  return tree_.Size() == 0;
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::size_type
+persistent_set<T, Compare>::size() const {
+  return tree_.Size();
+}
+template <typename T, typename Compare>
+void persistent_set<T, Compare>::clear() {
+  tree_.Clear();
+}
+template <typename T, typename Compare>
+bool persistent_set<T, Compare>::insert(const T& value) {
+  return tree_.Insert(value);
+}
+template <typename T, typename Compare>
+bool persistent_set<T, Compare>::insert(T&& value) {
+  return tree_.Insert(std::move(value));
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::size_type
+persistent_set<T, Compare>::erase(const T& key) {
+  return tree_.Remove(key) ? 1 : 0;
+}
+template <typename T, typename Compare>
+bool persistent_set<T, Compare>::contains(const T& key) const {
+  return tree_.Search(key) != nullptr;
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::iterator persistent_set<T, Compare>::find(
+    const T& key) const {
+  iterator it = lower_bound(key);
+  if (it == end() || tree_.GetCompare()(key, *it)) {
+    return end();
+  }
+  return it;
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::iterator
+persistent_set<T, Compare>::lower_bound(const T& key) const {
+  return iterator(tree_.Root(), tree_, key);
+}
+template <typename T, typename Compare>
+typename persistent_set<T, Compare>::key_compare
+persistent_set<T, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const typename persistent_set<T, Compare>::tree_type&
+persistent_set<T, Compare>::get_tree() const {
+  return tree_;
+}
+}  // namespace s21
@@ -3,28 +3,45 @@
 
 #include <algorithm>
 
+#include "../../vector/s21_vector.tpp"
 #include "../iterators/s21_iterator.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Compare = std::less<T>>
 class set {
  public:
+  using key_type = T;
   using value_type = T;
+  using key_compare = Compare;
   using iterator = Iterator<T, T>;
   using const_iterator = ConstIterator<T, T>;
   using size_type = size_t;
+  using reverse_iterator = std::reverse_iterator<iterator>;
   using Allocator = std::allocator<T>;
+  using node_type = NodeHandle<T, T>;
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
 
   set();
+  explicit set(const Compare& comp);
   set(std::initializer_list<value_type> const& items);
+  // Builds in O(n) from sorted input, O(n log n) otherwise
+  template <typename InputIt>
+  set(InputIt first, InputIt last);
   set(const set& s);
-  set(set<T>&& s) = default;
-  set<T>& operator=(set&& s);
+  set(set<T, Compare>&& s) = default;
+  set<T, Compare>& operator=(set&& s);
   ~set() {}
 
+  // O(1): the tree keeps its leftmost and rightmost nodes
   iterator begin();
   iterator end();
+  reverse_iterator rbegin();
+  reverse_iterator rend();
 
   bool empty();
   size_type size();
@@ -32,17 +49,62 @@ class set {
 
   void clear();
   std::pair<iterator, bool> insert(const T& value);
+  std::pair<iterator, bool> insert(T&& value);
+  // Amortized O(1) when value belongs right next to hint
+  iterator insert(iterator hint, const T& value);
+  iterator insert(iterator hint, T&& value);
+  // Construct the value once, directly inside its node
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
   void erase(iterator pos);
-  void swap(set<T>& other);
-  void merge(set<T>& other);
+  // Node handles: move elements between sets without allocating or
+  // copying. An empty handle is returned when key is absent.
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
+  insert_return_type insert(node_type&& node);
+  void swap(set<T, Compare>& other);
+  void merge(set<T, Compare>& other);
+  // Set algebra in O(m log(n / m + 1)); other is consumed and left empty
+  void set_union(set& other);
+  void set_intersection(set& other);
+  void set_difference(set& other);
+  // Keeps the keys less than key and returns the others, O(log n)
+  set split(const T& key);
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
   bool contains(const T& key);
   iterator find(const T& key);
-  const AVLTree<T, T>& get_tree() const;
+  // Finger search: starts at finger, cheap when key is close to it
+  iterator find(iterator finger, const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // Elements with lo <= key < hi: O(log n) to position, then O(1) per step
+  IteratorRange<iterator> range(const T& lo, const T& hi);
+  // Heterogeneous lookup, available when Compare::is_transparent exists
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
+
+  size_type rank(const T& key);
+  iterator select(size_type k);
+  iterator nth(size_type k);
+  size_type count_less(const T& key);
+
+  key_compare key_comp() const;
+  const AVLTree<T, T, Compare>& get_tree() const;
 
  private:
-  AVLTree<T, T> tree_;
+  AVLTree<T, T, Compare> tree_;
   Allocator allocator;
+
+  iterator MakeIterator(Node<T, T>* node) const;
 };
 }  // namespace s21
 
@@ -1,45 +1,46 @@
 #include "./s21_set.h"
 
 namespace s21 {
-template <typename T>
-set<T>::set() : tree_() {}
-template <typename T>
-set<T>::set(std::initializer_list<value_type> const& items) : tree_() {
-  for (auto i = items.begin(); i != items.end(); ++i) {
-    this->insert(*i);
-  }
+template <typename T, typename Compare>
+set<T, Compare>::set() : tree_() {}
+template <typename T, typename Compare>
+set<T, Compare>::set(const Compare& comp) : tree_(comp) {}
+template <typename T, typename Compare>
+set<T, Compare>::set(std::initializer_list<value_type> const& items)
+    : set(items.begin(), items.end()) {}
+template <typename T, typename Compare>
+template <typename InputIt>
+set<T, Compare>::set(InputIt first, InputIt last) : tree_() {
+  tree_.InsertMany(std::vector<value_type>(first, last));
 }
-template <typename T>
-set<T>::set(const set& s) : tree_(s.get_tree()) {}
-template <typename T>
-set<T>& set<T>::operator=(set<T>&& s) {
+template <typename T, typename Compare>
+set<T, Compare>::set(const set& s) : tree_(s.get_tree()) {}
+template <typename T, typename Compare>
+set<T, Compare>& set<T, Compare>::operator=(set<T, Compare>&& s) {
   if (this != &s) {
     tree_ = std::move(s.tree_);
   }
   return *this;
 }
 
-template <typename T>
-typename set<T>::iterator set<T>::begin() {
-  Node<T, T>* node = tree_.GetRoot();
-  if (node == nullptr) {
-    return iterator(nullptr);
-  }
-  while (node->left != nullptr && !node->left->isSentinel) {
-    node = node->left;
-  }
-  if (node->isSentinel) {
-    return iterator(nullptr);
-  } else {
-    return iterator(node);
-  }
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::begin() {
+  return MakeIterator(tree_.GetHeader()->leftmost);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::end() {
+  return MakeIterator(nullptr);
 }
-template <typename T>
-typename set<T>::iterator set<T>::end() {
-  return iterator(nullptr, tree_.GetRoot());
+template <typename T, typename Compare>
+typename set<T, Compare>::reverse_iterator set<T, Compare>::rbegin() {
+  return reverse_iterator(end());
 }
-template <typename T>
-bool set<T>::empty() {
+template <typename T, typename Compare>
+typename set<T, Compare>::reverse_iterator set<T, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+template <typename T, typename Compare>
+bool set<T, Compare>::empty() {
   if (this->tree_.GetRoot() == nullptr) {
     return true;
   }
@@ -48,66 +49,214 @@ bool set<T>::empty() {
   }
   return false;
 }
-template <typename T>
-typename set<T>::size_type set<T>::size() {
+template <typename T, typename Compare>
+typename set<T, Compare>::size_type set<T, Compare>::size() {
   if (this->tree_.GetRoot() == nullptr) {
     return 0;
   }
   return tree_.GetRoot()->size_;
 }
-template <typename T>
-typename set<T>::size_type set<T>::max_size() {
+template <typename T, typename Compare>
+typename set<T, Compare>::size_type set<T, Compare>::max_size() {
   return allocator.max_size() / 10;
 }
-template <typename T>
-void set<T>::clear() {
+template <typename T, typename Compare>
+void set<T, Compare>::clear() {
   if (this->tree_.GetRoot()) {
     Node<T, T>* root = this->tree_.GetRoot();
     this->tree_.Clear(root);
     this->tree_.SetRoot(nullptr);
   }
 }
-template <typename T>
-std::pair<typename set<T>::iterator, bool> set<T>::insert(const T& value) {
-  std::pair<typename set<T>::iterator, bool> result;
-  this->tree_.Insert(value);
-  if (this->tree_.GetInserted()) {
-    result = std::pair<typename set<T>::iterator, bool>(find(value), true);
-  } else {
-    result = std::pair<typename set<T>::iterator, bool>(find(value), false);
-  }
-  return result;
+template <typename T, typename Compare>
+std::pair<typename set<T, Compare>::iterator, bool> set<T, Compare>::insert(
+    const T& value) {
+  Node<T, T>* node = this->tree_.Insert(value);
+  return std::pair<iterator, bool>(MakeIterator(node),
+                                   this->tree_.GetInserted());
+}
+template <typename T, typename Compare>
+std::pair<typename set<T, Compare>::iterator, bool> set<T, Compare>::insert(
+    T&& value) {
+  Node<T, T>* node = tree_.Insert(std::move(value));
+  return std::pair<iterator, bool>(MakeIterator(node), tree_.GetInserted());
+}
+template <typename T, typename Compare>
+template <typename... Args>
+std::pair<typename set<T, Compare>::iterator, bool> set<T, Compare>::emplace(
+    Args&&... args) {
+  Node<T, T>* node = tree_.Emplace(std::forward<Args>(args)...);
+  return std::pair<iterator, bool>(MakeIterator(node), tree_.GetInserted());
 }
 
-template <typename T>
-void set<T>::erase(set<T>::iterator pos) {
+template <typename T, typename Compare>
+void set<T, Compare>::erase(set<T, Compare>::iterator pos) {
   if (pos != nullptr) {
-    tree_.Remove(*pos);
+    tree_.Remove(pos.GetNode());
   }
 }
-template <typename T>
-void set<T>::swap(set<T>& other) {
+template <typename T, typename Compare>
+typename set<T, Compare>::node_type set<T, Compare>::extract(iterator pos) {
+  return tree_.Extract(pos.GetNode());
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::node_type set<T, Compare>::extract(const T& key) {
+  return tree_.Extract(tree_.Search(key));
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::insert_return_type set<T, Compare>::insert(
+    node_type&& node) {
+  Node<T, T>* found = tree_.Insert(std::move(node));
+  bool inserted = tree_.GetInserted();
+  return {MakeIterator(found), inserted,
+          inserted ? node_type() : std::move(node)};
+}
+template <typename T, typename Compare>
+void set<T, Compare>::swap(set<T, Compare>& other) {
   tree_.Swap(other.tree_);
 }
-template <typename T>
-void set<T>::merge(set<T>& other) {
-  if (this != &other) {
-    for (auto i = other.begin(); i != other.end(); i++) {
-      insert(*i);
-    }
+template <typename T, typename Compare>
+void set<T, Compare>::merge(set<T, Compare>& other) {
+  tree_.Union(other.tree_);
+}
+template <typename T, typename Compare>
+void set<T, Compare>::set_union(set& other) {
+  tree_.Union(other.tree_);
+}
+template <typename T, typename Compare>
+void set<T, Compare>::set_intersection(set& other) {
+  tree_.Intersection(other.tree_);
+}
+template <typename T, typename Compare>
+void set<T, Compare>::set_difference(set& other) {
+  tree_.Difference(other.tree_);
+}
+template <typename T, typename Compare>
+set<T, Compare> set<T, Compare>::split(const T& key) {
+  set<T, Compare> result(key_comp());
+  tree_.Split(key, result.tree_);
+  return result;
+}
+template <typename T, typename Compare>
+template <typename... Args>
+s21::vector<std::pair<typename set<T, Compare>::iterator, bool>>
+set<T, Compare>::insert_many(Args&&... args) {
+  std::vector<value_type> values;
+  values.reserve(sizeof...(args));
+  (values.emplace_back(std::forward<Args>(args)), ...);
+  auto nodes = tree_.InsertMany(std::move(values));
+  s21::vector<std::pair<iterator, bool>> result;
+  result.reserve(nodes.size());
+  for (const auto& node : nodes) {
+    result.push_back(std::make_pair(MakeIterator(node.first), node.second));
   }
-  other.clear();
+  return result;
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::insert(
+    iterator hint, const T& value) {
+  return MakeIterator(tree_.Insert(hint.GetNode(), value));
 }
-template <typename T>
-bool set<T>::contains(const T& key) {
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::insert(iterator hint,
+                                                           T&& value) {
+  return MakeIterator(tree_.Insert(hint.GetNode(), std::move(value)));
+}
+template <typename T, typename Compare>
+template <typename... Args>
+typename set<T, Compare>::iterator set<T, Compare>::emplace_hint(
+    iterator hint, Args&&... args) {
+  return MakeIterator(
+      tree_.EmplaceHint(hint.GetNode(), std::forward<Args>(args)...));
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::find(
+    iterator finger, const T& key) {
+  return MakeIterator(tree_.FingerSearch(finger.GetNode(), key));
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::lower_bound(
+    const T& key) {
+  Node<T, T>* node = tree_.LowerBound(key);
+  return MakeIterator(node);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::upper_bound(
+    const T& key) {
+  Node<T, T>* node = tree_.UpperBound(key);
+  return MakeIterator(node);
+}
+template <typename T, typename Compare>
+std::pair<typename set<T, Compare>::iterator,
+          typename set<T, Compare>::iterator>
+set<T, Compare>::equal_range(const T& key) {
+  iterator first = lower_bound(key);
+  if (first == end() || tree_.GetCompare()(key, first.GetNode()->key)) {
+    return std::make_pair(first, first);
+  }
+  iterator last = first;
+  return std::make_pair(first, ++last);
+}
+template <typename T, typename Compare>
+IteratorRange<typename set<T, Compare>::iterator> set<T, Compare>::range(
+    const T& lo, const T& hi) {
+  if (!tree_.GetCompare()(lo, hi)) {
+    return IteratorRange<iterator>(end(), end());
+  }
+  return IteratorRange<iterator>(lower_bound(lo), lower_bound(hi));
+}
+template <typename T, typename Compare>
+bool set<T, Compare>::contains(const T& key) {
   return tree_.Search(key) != nullptr;
 }
-template <typename T>
-typename set<T>::iterator set<T>::find(const T& key) {
-  return iterator(tree_.Search(key));
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::find(const T& key) {
+  return MakeIterator(tree_.Search(key));
+}
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+bool set<T, Compare>::contains(const K& key) {
+  return tree_.Search(key) != nullptr;
 }
-template <typename T>
-const AVLTree<T, T>& set<T>::get_tree() const {
+template <typename T, typename Compare>
+template <typename K, typename C, typename>
+typename set<T, Compare>::iterator set<T, Compare>::find(const K& key) {
+  return MakeIterator(tree_.Search(key));
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::size_type set<T, Compare>::rank(const T& key) {
+  if (!contains(key)) {
+    return size();
+  }
+  return tree_.CountLess(key);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::select(size_type k) {
+  Node<T, T>* node = tree_.Select(k);
+  if (node == nullptr) {
+    return end();
+  }
+  return MakeIterator(node);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::nth(size_type k) {
+  return select(k);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::size_type set<T, Compare>::count_less(const T& key) {
+  return tree_.CountLess(key);
+}
+template <typename T, typename Compare>
+typename set<T, Compare>::key_compare set<T, Compare>::key_comp() const {
+  return tree_.GetCompare();
+}
+template <typename T, typename Compare>
+const AVLTree<T, T, Compare>& set<T, Compare>::get_tree() const {
   return tree_;
 }
+template <typename T, typename Compare>
+typename set<T, Compare>::iterator set<T, Compare>::MakeIterator(
+    Node<T, T>* node) const {
+  return iterator(node, tree_.GetHeader());
+}
 }  // namespace s21
@@ -0,0 +1,80 @@
+#ifndef SRC_SMALL_ITERATOR_H_
+#define SRC_SMALL_ITERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "../iterators/s21_iterator.h"
+
+namespace s21 {
+// Bidirectional iterator of SmallTable. While the table is inline it
+// walks the table's array of slot numbers, one byte per element in key
+// order; once the table has spilled it wraps a tree Iterator. The two are
+// told apart by rank_, which is null for a tree position.
+template <typename T, typename V>
+class SmallIterator {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using pointer = T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  SmallIterator() : rank_(nullptr), slots_(nullptr), node_() {}
+  SmallIterator(const uint8_t* rank, T* slots)
+      : rank_(rank), slots_(slots), node_() {}
+  explicit SmallIterator(Iterator<T, V> node)
+      : rank_(nullptr), slots_(nullptr), node_(node) {}
+
+  reference operator*() const {
+    return rank_ != nullptr ? slots_[*rank_] : node_.GetNode()->key;
+  }
+  pointer operator->() const { return &**this; }
+
+  SmallIterator& operator++() {
+    if (rank_ != nullptr) {
+      ++rank_;
+    } else {
+      ++node_;
+    }
+    return *this;
+  }
+  SmallIterator operator++(int) {
+    SmallIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  SmallIterator& operator--() {
+    if (rank_ != nullptr) {
+      --rank_;
+    } else {
+      --node_;
+    }
+    return *this;
+  }
+  SmallIterator operator--(int) {
+    SmallIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  bool operator==(const SmallIterator& other) const {
+    return rank_ == other.rank_ && node_ == other.node_;
+  }
+  bool operator!=(const SmallIterator& other) const {
+    return !(*this == other);
+  }
+
+  // Position in the table's slot order, null for a tree position
+  const uint8_t* GetRank() const { return rank_; }
+  Node<T, V>* GetNode() const { return node_.GetNode(); }
+
+ private:
+  const uint8_t* rank_;
+  T* slots_;
+  Iterator<T, V> node_;
+};
+}  // namespace s21
+
+#endif  // SRC_SMALL_ITERATOR_H_
@@ -0,0 +1,88 @@
+#ifndef AVL_SMALL_MAP_H_
+#define AVL_SMALL_MAP_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+#include "s21_small_table.tpp"
+
+namespace s21 {
+// map counterpart of small_set: the first N pairs live inside the object,
+// the map switches to an AVLTree when an insert finds them full. Same
+// interface as s21::map, minus node handles, set algebra, order
+// statistics and aggregates; node stability is lost as in small_set.
+template <typename K, typename V, size_t N = 16,
+          typename Compare = std::less<K>>
+class small_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using key_compare = Compare;
+  using table_type =
+      SmallTable<value_type, V, N, Compare, SelectFirst<value_type>>;
+  using iterator = typename table_type::iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  small_map();
+  explicit small_map(const Compare& comp);
+  small_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  small_map(InputIt first, InputIt last);
+  small_map(const small_map& m) = default;
+  small_map(small_map&& m) = default;
+  small_map& operator=(const small_map& m);
+  small_map& operator=(small_map&& m) = default;
+  ~small_map() = default;
+
+  V& at(const K& key);
+  V& operator[](const K& key);
+
+  iterator begin();
+  iterator end();
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  // Whether the elements are still inside the object
+  bool is_inline() const;
+
+  // Also returns the map to its inline storage
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const K& key, const V& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // The mapped value is built from args only when key is absent
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const K& key, Args&&... args);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj);
+  void erase(iterator pos);
+  size_type erase(const K& key);
+  void swap(small_map& other);
+
+  bool contains(const K& key);
+  iterator find(const K& key);
+  size_type count(const K& key);
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const K& key);
+  std::pair<iterator, iterator> equal_range(const K& key);
+
+  key_compare key_comp() const;
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // AVL_SMALL_MAP_H_
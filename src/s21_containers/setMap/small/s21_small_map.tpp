@@ -0,0 +1,174 @@
+#include "s21_small_map.h"
+
+namespace s21 {
+template <typename K, typename V, size_t N, typename Compare>
+small_map<K, V, N, Compare>::small_map() : table_(Compare()) {}
+template <typename K, typename V, size_t N, typename Compare>
+small_map<K, V, N, Compare>::small_map(const Compare& comp) : table_(comp) {}
+template <typename K, typename V, size_t N, typename Compare>
+small_map<K, V, N, Compare>::small_map(
+    std::initializer_list<value_type> const& items)
+    : small_map(items.begin(), items.end()) {}
+template <typename K, typename V, size_t N, typename Compare>
+template <typename InputIt>
+small_map<K, V, N, Compare>::small_map(InputIt first, InputIt last)
+    : table_(Compare()) {
+  for (; first != last; ++first) insert(*first);
+}
+template <typename K, typename V, size_t N, typename Compare>
+small_map<K, V, N, Compare>& small_map<K, V, N, Compare>::operator=(
+    const small_map& m) {
+  if (this != &m) {
+    small_map copy(m);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+V& small_map<K, V, N, Compare>::at(const K& key) {
+  iterator pos = find(key);
+  if (pos == end()) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return pos->second;
+}
+template <typename K, typename V, size_t N, typename Compare>
+V& small_map<K, V, N, Compare>::operator[](const K& key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::iterator
+small_map<K, V, N, Compare>::begin() {
+  return table_.Begin();
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::iterator
+small_map<K, V, N, Compare>::end() {
+  return table_.End();
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::reverse_iterator
+small_map<K, V, N, Compare>::rbegin() {
+  return reverse_iterator(end());
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::reverse_iterator
+small_map<K, V, N, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+bool small_map<K, V, N, Compare>::empty() {
+  return table_.Size() == 0;
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::size_type
+small_map<K, V, N, Compare>::size() {
+  return table_.Size();
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::size_type
+small_map<K, V, N, Compare>::max_size() {
+  return std::allocator<value_type>().max_size() / 10;
+}
+template <typename K, typename V, size_t N, typename Compare>
+bool small_map<K, V, N, Compare>::is_inline() const {
+  return table_.Inline();
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+void small_map<K, V, N, Compare>::clear() {
+  table_.Clear();
+}
+template <typename K, typename V, size_t N, typename Compare>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::insert(const value_type& value) {
+  return table_.TryEmplace(value.first, value);
+}
+template <typename K, typename V, size_t N, typename Compare>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::insert(value_type&& value) {
+  return table_.TryEmplace(value.first, std::move(value));
+}
+template <typename K, typename V, size_t N, typename Compare>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::insert(const K& key, const V& obj) {
+  return try_emplace(key, obj);
+}
+template <typename K, typename V, size_t N, typename Compare>
+template <typename... Args>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::emplace(Args&&... args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+template <typename K, typename V, size_t N, typename Compare>
+template <typename... Args>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::try_emplace(const K& key, Args&&... args) {
+  return table_.TryEmplace(key, std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+}
+template <typename K, typename V, size_t N, typename Compare>
+template <typename M>
+std::pair<typename small_map<K, V, N, Compare>::iterator, bool>
+small_map<K, V, N, Compare>::insert_or_assign(const K& key, M&& obj) {
+  auto result = try_emplace(key, std::forward<M>(obj));
+  if (!result.second) {
+    result.first->second = std::forward<M>(obj);
+  }
+  return result;
+}
+template <typename K, typename V, size_t N, typename Compare>
+void small_map<K, V, N, Compare>::erase(iterator pos) {
+  table_.Erase(pos);
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::size_type
+small_map<K, V, N, Compare>::erase(const K& key) {
+  return table_.Erase(key);
+}
+template <typename K, typename V, size_t N, typename Compare>
+void small_map<K, V, N, Compare>::swap(small_map& other) {
+  table_.Swap(other.table_);
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+bool small_map<K, V, N, Compare>::contains(const K& key) {
+  return find(key) != end();
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::iterator
+small_map<K, V, N, Compare>::find(const K& key) {
+  return table_.Find(key);
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::size_type
+small_map<K, V, N, Compare>::count(const K& key) {
+  return contains(key) ? 1 : 0;
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::iterator
+small_map<K, V, N, Compare>::lower_bound(const K& key) {
+  return table_.LowerBound(key);
+}
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::iterator
+small_map<K, V, N, Compare>::upper_bound(const K& key) {
+  return table_.UpperBound(key);
+}
+template <typename K, typename V, size_t N, typename Compare>
+std::pair<typename small_map<K, V, N, Compare>::iterator,
+          typename small_map<K, V, N, Compare>::iterator>
+small_map<K, V, N, Compare>::equal_range(const K& key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename K, typename V, size_t N, typename Compare>
+typename small_map<K, V, N, Compare>::key_compare
+small_map<K, V, N, Compare>::key_comp() const {
+  return table_.GetCompare();
+}
+}  // namespace s21
@@ -0,0 +1,79 @@
+#ifndef AVL_SMALL_SET_H_
+#define AVL_SMALL_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+#include "s21_small_table.tpp"
+
+namespace s21 {
+// set for the many instances that stay small: the first N elements live
+// inside the object in key order, with no allocation at all, and the set
+// switches to an AVLTree when an insert finds them full. Same interface
+// as s21::set, minus node handles, set algebra and order statistics.
+//
+// Unlike s21::set, nodes are not stable: moving or swapping an inline set
+// moves its elements, and the switch to the tree invalidates all
+// iterators and references. While inline, an insert or erase leaves the
+// other elements where they are.
+template <typename T, size_t N = 16, typename Compare = std::less<T>>
+class small_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using key_compare = Compare;
+  using table_type = SmallTable<T, T, N, Compare, Identity<T>>;
+  using iterator = typename table_type::iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = size_t;
+
+  small_set();
+  explicit small_set(const Compare& comp);
+  small_set(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  small_set(InputIt first, InputIt last);
+  small_set(const small_set& s) = default;
+  small_set(small_set&& s) = default;
+  small_set& operator=(const small_set& s);
+  small_set& operator=(small_set&& s) = default;
+  ~small_set() = default;
+
+  iterator begin();
+  iterator end();
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  // Whether the elements are still inside the object
+  bool is_inline() const;
+
+  // Also returns the set to its inline storage
+  void clear();
+  std::pair<iterator, bool> insert(const T& value);
+  std::pair<iterator, bool> insert(T&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(small_set& other);
+
+  bool contains(const T& key);
+  iterator find(const T& key);
+  size_type count(const T& key);
+  iterator lower_bound(const T& key);
+  iterator upper_bound(const T& key);
+  std::pair<iterator, iterator> equal_range(const T& key);
+
+  key_compare key_comp() const;
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // AVL_SMALL_SET_H_
@@ -0,0 +1,135 @@
+#include "s21_small_set.h"
+
+namespace s21 {
+template <typename T, size_t N, typename Compare>
+small_set<T, N, Compare>::small_set() : table_(Compare()) {}
+template <typename T, size_t N, typename Compare>
+small_set<T, N, Compare>::small_set(const Compare& comp) : table_(comp) {}
+template <typename T, size_t N, typename Compare>
+small_set<T, N, Compare>::small_set(
+    std::initializer_list<value_type> const& items)
+    : small_set(items.begin(), items.end()) {}
+template <typename T, size_t N, typename Compare>
+template <typename InputIt>
+small_set<T, N, Compare>::small_set(InputIt first, InputIt last)
+    : table_(Compare()) {
+  for (; first != last; ++first) insert(*first);
+}
+template <typename T, size_t N, typename Compare>
+small_set<T, N, Compare>& small_set<T, N, Compare>::operator=(
+    const small_set& s) {
+  if (this != &s) {
+    small_set copy(s);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::iterator small_set<T, N, Compare>::begin() {
+  return table_.Begin();
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::iterator small_set<T, N, Compare>::end() {
+  return table_.End();
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::reverse_iterator
+small_set<T, N, Compare>::rbegin() {
+  return reverse_iterator(end());
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::reverse_iterator
+small_set<T, N, Compare>::rend() {
+  return reverse_iterator(begin());
+}
+
+template <typename T, size_t N, typename Compare>
+bool small_set<T, N, Compare>::empty() {
+  return table_.Size() == 0;
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::size_type small_set<T, N, Compare>::size() {
+  return table_.Size();
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::size_type
+small_set<T, N, Compare>::max_size() {
+  return std::allocator<T>().max_size() / 10;
+}
+template <typename T, size_t N, typename Compare>
+bool small_set<T, N, Compare>::is_inline() const {
+  return table_.Inline();
+}
+
+template <typename T, size_t N, typename Compare>
+void small_set<T, N, Compare>::clear() {
+  table_.Clear();
+}
+template <typename T, size_t N, typename Compare>
+std::pair<typename small_set<T, N, Compare>::iterator, bool>
+small_set<T, N, Compare>::insert(const T& value) {
+  return table_.TryEmplace(value, value);
+}
+template <typename T, size_t N, typename Compare>
+std::pair<typename small_set<T, N, Compare>::iterator, bool>
+small_set<T, N, Compare>::insert(T&& value) {
+  return table_.TryEmplace(value, std::move(value));
+}
+template <typename T, size_t N, typename Compare>
+template <typename... Args>
+std::pair<typename small_set<T, N, Compare>::iterator, bool>
+small_set<T, N, Compare>::emplace(Args&&... args) {
+  return insert(T(std::forward<Args>(args)...));
+}
+template <typename T, size_t N, typename Compare>
+void small_set<T, N, Compare>::erase(iterator pos) {
+  table_.Erase(pos);
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::size_type small_set<T, N, Compare>::erase(
+    const T& key) {
+  return table_.Erase(key);
+}
+template <typename T, size_t N, typename Compare>
+void small_set<T, N, Compare>::swap(small_set& other) {
+  table_.Swap(other.table_);
+}
+
+template <typename T, size_t N, typename Compare>
+bool small_set<T, N, Compare>::contains(const T& key) {
+  return find(key) != end();
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::iterator small_set<T, N, Compare>::find(
+    const T& key) {
+  return table_.Find(key);
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::size_type small_set<T, N, Compare>::count(
+    const T& key) {
+  return contains(key) ? 1 : 0;
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::iterator
+small_set<T, N, Compare>::lower_bound(const T& key) {
+  return table_.LowerBound(key);
+}
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::iterator
+small_set<T, N, Compare>::upper_bound(const T& key) {
+  return table_.UpperBound(key);
+}
+template <typename T, size_t N, typename Compare>
+std::pair<typename small_set<T, N, Compare>::iterator,
+          typename small_set<T, N, Compare>::iterator>
+small_set<T, N, Compare>::equal_range(const T& key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename T, size_t N, typename Compare>
+typename small_set<T, N, Compare>::key_compare
+small_set<T, N, Compare>::key_comp() const {
+  return table_.GetCompare();
+}
+}  // namespace s21
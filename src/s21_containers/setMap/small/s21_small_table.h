@@ -0,0 +1,145 @@
+#ifndef SRC_SMALL_TABLE_H_
+#define SRC_SMALL_TABLE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_small_iterator.h"
+
+namespace s21 {
+// Room for N elements inside the owning object. An element is built in a
+// free slot and stays there until it is erased; order_ lists the slot
+// numbers in key order, so an insert or erase shifts one byte per later
+// element and never moves an element.
+template <typename T, size_t N>
+class InlineSlots {
+  static_assert(N > 0 && N <= 64, "free slots are tracked in 64 bits");
+
+ public:
+  InlineSlots() : used_(0), size_(0) {}
+  InlineSlots(const InlineSlots&) = delete;
+  InlineSlots& operator=(const InlineSlots&) = delete;
+  ~InlineSlots() { Clear(); }
+
+  size_t size() const { return size_; }
+  bool full() const { return size_ == N; }
+  T* slots() { return reinterpret_cast<T*>(storage_); }
+  const uint8_t* order() const { return order_; }
+  T& At(size_t rank) { return slots()[order_[rank]]; }
+  const T& At(size_t rank) const {
+    return reinterpret_cast<const T*>(storage_)[order_[rank]];
+  }
+
+  // First rank whose element fails pred, for a pred that holds for a
+  // prefix of the elements
+  template <typename Pred>
+  size_t PartitionPoint(Pred pred) {
+    size_t lo = 0;
+    size_t hi = size_;
+    while (lo < hi) {
+      size_t mid = (lo + hi) / 2;
+      if (pred(At(mid))) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+  // Builds an element from args at rank; the slots must not be full. Only
+  // the constructor can throw, and then nothing has changed.
+  template <typename... Args>
+  void EmplaceAt(size_t rank, Args&&... args) {
+    uint8_t slot = static_cast<uint8_t>(__builtin_ctzll(~used_));
+    new (slots() + slot) T(std::forward<Args>(args)...);
+    used_ |= uint64_t(1) << slot;
+    std::memmove(order_ + rank + 1, order_ + rank, size_ - rank);
+    order_[rank] = slot;
+    size_++;
+  }
+  void EraseAt(size_t rank) {
+    uint8_t slot = order_[rank];
+    slots()[slot].~T();
+    used_ &= ~(uint64_t(1) << slot);
+    std::memmove(order_ + rank, order_ + rank + 1, size_ - rank - 1);
+    size_--;
+  }
+  // Rebuilds the element at rank from value; the move must not throw
+  void Reset(size_t rank, T&& value) {
+    T* slot = &At(rank);
+    slot->~T();
+    new (slot) T(std::move(value));
+  }
+  void Clear() {
+    for (size_t rank = 0; rank < size_; rank++) At(rank).~T();
+    used_ = 0;
+    size_ = 0;
+  }
+
+ private:
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+  uint8_t order_[N];
+  uint64_t used_;
+  size_t size_;
+};
+
+// Engine of small_set and small_map: up to N unique elements kept inline,
+// with no allocation, and an AVLTree once an insert finds the slots full.
+// The table stays a tree until it is cleared. Lookups in the inline mode
+// binary search the slot order; inserts and erases shift slot numbers
+// only. Switching to the tree moves the elements into nodes, so it
+// invalidates every iterator and reference.
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+class SmallTable {
+ public:
+  using iterator = SmallIterator<T, V>;
+  using tree_type = AVLTree<T, V, Compare, KeyOfValue>;
+
+  explicit SmallTable(const Compare& comp);
+  SmallTable(const SmallTable& other);
+  SmallTable(SmallTable&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  SmallTable& operator=(SmallTable&& other);
+  ~SmallTable() = default;
+
+  iterator Begin();
+  iterator End();
+  size_t Size() const;
+  bool Inline() const;
+  void Clear();
+  void Swap(SmallTable& other);
+
+  template <typename K>
+  iterator Find(const K& key);
+  template <typename K>
+  iterator LowerBound(const K& key);
+  template <typename K>
+  iterator UpperBound(const K& key);
+  // Looks key up and builds the element from args only when it is absent;
+  // the bool tells whether it was inserted
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args);
+  void Erase(iterator pos);
+  template <typename K>
+  size_t Erase(const K& key);
+  const Compare& GetCompare() const;
+
+ private:
+  InlineSlots<T, N> slots_;
+  tree_type tree_;
+  bool spilled_;
+  KeyOfValue key_of_;
+
+  iterator AtRank(size_t rank);
+  iterator MakeIterator(Node<T, V>* node) const;
+  void MoveSlotsFrom(SmallTable& other);
+  template <typename... Args>
+  Node<T, V>* Spill(Args&&... args);
+};
+}  // namespace s21
+
+#endif  // SRC_SMALL_TABLE_H_
@@ -0,0 +1,228 @@
+#ifndef SMALL_TABLE_TPP
+#define SMALL_TABLE_TPP
+#include "s21_small_table.h"
+
+namespace s21 {
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+SmallTable<T, V, N, Compare, KeyOfValue>::SmallTable(const Compare& comp)
+    : slots_(), tree_(comp), spilled_(false), key_of_() {}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+SmallTable<T, V, N, Compare, KeyOfValue>::SmallTable(const SmallTable& other)
+    : slots_(), tree_(other.tree_), spilled_(other.spilled_), key_of_() {
+  for (size_t rank = 0; rank < other.slots_.size(); rank++) {
+    slots_.EmplaceAt(rank, other.slots_.At(rank));
+  }
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+SmallTable<T, V, N, Compare, KeyOfValue>::SmallTable(
+    SmallTable&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : slots_(),
+      tree_(std::move(other.tree_)),
+      spilled_(other.spilled_),
+      key_of_() {
+  MoveSlotsFrom(other);
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+SmallTable<T, V, N, Compare, KeyOfValue>&
+SmallTable<T, V, N, Compare, KeyOfValue>::operator=(SmallTable&& other) {
+  if (this != &other) {
+    Clear();
+    tree_ = std::move(other.tree_);
+    spilled_ = other.spilled_;
+    MoveSlotsFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::Begin() {
+  return spilled_ ? MakeIterator(tree_.GetHeader()->leftmost) : AtRank(0);
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::End() {
+  return spilled_ ? MakeIterator(nullptr) : AtRank(slots_.size());
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+size_t SmallTable<T, V, N, Compare, KeyOfValue>::Size() const {
+  if (!spilled_) {
+    return slots_.size();
+  }
+  return tree_.GetRoot() ? tree_.GetRoot()->size_ : 0;
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+bool SmallTable<T, V, N, Compare, KeyOfValue>::Inline() const {
+  return !spilled_;
+}
+// A cleared table is inline again
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+void SmallTable<T, V, N, Compare, KeyOfValue>::Clear() {
+  slots_.Clear();
+  if (tree_.GetRoot()) {
+    tree_.Clear(tree_.GetRoot());
+    tree_.SetRoot(nullptr);
+  }
+  spilled_ = false;
+}
+// Inline elements have no node to relink, so they move element by element
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+void SmallTable<T, V, N, Compare, KeyOfValue>::Swap(SmallTable& other) {
+  SmallTable tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename K>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::Find(const K& key) {
+  if (spilled_) {
+    return MakeIterator(tree_.Search(key));
+  }
+  iterator pos = LowerBound(key);
+  if (pos == End() || GetCompare()(key, key_of_(*pos))) {
+    return End();
+  }
+  return pos;
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename K>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::LowerBound(const K& key) {
+  if (spilled_) {
+    return MakeIterator(tree_.LowerBound(key));
+  }
+  const Compare& comp = GetCompare();
+  return AtRank(slots_.PartitionPoint(
+      [&](const T& value) { return comp(key_of_(value), key); }));
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename K>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::UpperBound(const K& key) {
+  if (spilled_) {
+    return MakeIterator(tree_.UpperBound(key));
+  }
+  const Compare& comp = GetCompare();
+  return AtRank(slots_.PartitionPoint(
+      [&](const T& value) { return !comp(key, key_of_(value)); }));
+}
+// key is read before args are consumed, also when the insert spills
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename K, typename... Args>
+std::pair<typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator, bool>
+SmallTable<T, V, N, Compare, KeyOfValue>::TryEmplace(const K& key,
+                                                     Args&&... args) {
+  if (spilled_) {
+    Node<T, V>* node = tree_.TryEmplace(key, std::forward<Args>(args)...);
+    return {MakeIterator(node), tree_.GetInserted()};
+  }
+  iterator pos = LowerBound(key);
+  size_t rank = pos.GetRank() - slots_.order();
+  if (pos != End() && !GetCompare()(key, key_of_(*pos))) {
+    return {pos, false};
+  }
+  if (slots_.full()) {
+    return {MakeIterator(Spill(std::forward<Args>(args)...)), true};
+  }
+  slots_.EmplaceAt(rank, std::forward<Args>(args)...);
+  return {AtRank(rank), true};
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+void SmallTable<T, V, N, Compare, KeyOfValue>::Erase(iterator pos) {
+  if (pos.GetRank() != nullptr) {
+    slots_.EraseAt(pos.GetRank() - slots_.order());
+  } else if (pos.GetNode() != nullptr) {
+    tree_.Remove(pos.GetNode());
+  }
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename K>
+size_t SmallTable<T, V, N, Compare, KeyOfValue>::Erase(const K& key) {
+  iterator pos = Find(key);
+  if (pos == End()) {
+    return 0;
+  }
+  Erase(pos);
+  return 1;
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+const Compare& SmallTable<T, V, N, Compare, KeyOfValue>::GetCompare() const {
+  return tree_.GetCompare();
+}
+
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::AtRank(size_t rank) {
+  return iterator(slots_.order() + rank, slots_.slots());
+}
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+typename SmallTable<T, V, N, Compare, KeyOfValue>::iterator
+SmallTable<T, V, N, Compare, KeyOfValue>::MakeIterator(
+    Node<T, V>* node) const {
+  return iterator(Iterator<T, V>(node, tree_.GetHeader()));
+}
+// other is left inline and empty
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+void SmallTable<T, V, N, Compare, KeyOfValue>::MoveSlotsFrom(
+    SmallTable& other) {
+  for (size_t rank = 0; rank < other.slots_.size(); rank++) {
+    slots_.EmplaceAt(rank, std::move(other.slots_.At(rank)));
+  }
+  other.slots_.Clear();
+  other.spilled_ = false;
+}
+// Builds the new element in the tree first, so that args may refer to an
+// inline element, then moves the inline ones over; elements whose move may
+// throw are copied. If anything throws the table is left inline and
+// unchanged. Returns the new element's node.
+template <typename T, typename V, size_t N, typename Compare,
+          typename KeyOfValue>
+template <typename... Args>
+Node<T, V>* SmallTable<T, V, N, Compare, KeyOfValue>::Spill(Args&&... args) {
+  // The tree is empty while the table is inline
+  Node<T, V>* node = tree_.Emplace(std::forward<Args>(args)...);
+  size_t moved = 0;
+  try {
+    for (; moved < slots_.size(); moved++) {
+      tree_.Insert(std::move_if_noexcept(slots_.At(moved)));
+    }
+  } catch (...) {
+    if constexpr (std::is_nothrow_move_constructible<T>::value) {
+      // The elements were moved, so moving them back cannot throw either
+      Iterator<T, V> it(tree_.GetHeader()->leftmost, tree_.GetHeader());
+      for (size_t rank = 0; rank < moved; ++it) {
+        if (it.GetNode() != node) slots_.Reset(rank++, std::move(*it));
+      }
+    }
+    tree_.Clear(tree_.GetRoot());
+    tree_.SetRoot(nullptr);
+    throw;
+  }
+  slots_.Clear();
+  spilled_ = true;
+  return node;
+}
+}  // namespace s21
+#endif  // SMALL_TABLE_TPP
@@ -0,0 +1,66 @@
+#ifndef SRC_SWISS_GROUP_H_
+#define SRC_SWISS_GROUP_H_
+
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+// Control bytes of a SwissTable: one per slot. A full slot stores the low
+// seven bits of its hash (H2), so its byte is in [0, 127]; the two free
+// states have the high bit set.
+enum SwissCtrl : int8_t { kSwissEmpty = -128, kSwissDeleted = -2 };
+
+// Sixteen control bytes looked at together. Each Match* returns a mask
+// with bit i set when byte i qualifies. With SSE2 that is one compare and
+// one movemask; without it, a loop the compiler can still vectorize.
+class SwissGroup {
+ public:
+  static constexpr int kWidth = 16;
+
+  // ctrl must be 16-byte aligned
+  explicit SwissGroup(const int8_t* ctrl) {
+#ifdef __SSE2__
+    ctrl_ = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    for (int i = 0; i < kWidth; i++) ctrl_[i] = ctrl[i];
+#endif
+  }
+
+  uint32_t Match(int8_t h2) const { return MatchByte(h2); }
+  uint32_t MatchEmpty() const { return MatchByte(kSwissEmpty); }
+  // Empty and deleted bytes are the ones with the high bit set
+  uint32_t MatchFree() const {
+#ifdef __SSE2__
+    return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < kWidth; i++) mask |= uint32_t(ctrl_[i] < 0) << i;
+    return mask;
+#endif
+  }
+  uint32_t MatchFull() const { return ~MatchFree() & 0xFFFFu; }
+
+ private:
+  uint32_t MatchByte(int8_t byte) const {
+#ifdef __SSE2__
+    __m128i match = _mm_cmpeq_epi8(_mm_set1_epi8(byte), ctrl_);
+    return static_cast<uint32_t>(_mm_movemask_epi8(match));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < kWidth; i++) mask |= uint32_t(ctrl_[i] == byte) << i;
+    return mask;
+#endif
+  }
+
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  int8_t ctrl_[kWidth];
+#endif
+};
+}  // namespace s21
+
+#endif  // SRC_SWISS_GROUP_H_
@@ -0,0 +1,102 @@
+#ifndef SRC_SWISS_ITERATOR_H_
+#define SRC_SWISS_ITERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_swiss_group.h"
+
+namespace s21 {
+// One open-addressing table of a SwissTable: capacity control bytes,
+// then capacity slots, in one 16-byte aligned block
+template <typename T>
+struct SwissSlots {
+  int8_t* ctrl = nullptr;
+  T* slots = nullptr;
+  size_t capacity = 0;
+  // Empty slots that may still be filled before the table must grow
+  size_t growth_left = 0;
+};
+
+// Forward iterator over a SwissTable: the full slots of the current table,
+// then those of the table being migrated, if any. It skips free slots
+// sixteen at a time.
+template <typename T, bool kConst>
+class SwissIterator {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using reference = std::conditional_t<kConst, const T&, T&>;
+  using pointer = std::conditional_t<kConst, const T*, T*>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::forward_iterator_tag;
+
+  SwissIterator() : tables_(nullptr), table_(1), index_(0) {}
+  // Positions at the first full slot from index on
+  SwissIterator(const SwissSlots<T>* tables, int table, size_t index)
+      : tables_(tables), table_(table), index_(index) {
+    SkipFree();
+  }
+  // iterator converts to const_iterator
+  template <bool kOther, typename = std::enable_if_t<kConst && !kOther>>
+  SwissIterator(const SwissIterator<T, kOther>& other)
+      : tables_(other.tables()), table_(other.table()),
+        index_(other.index()) {}
+
+  reference operator*() const { return tables_[table_].slots[index_]; }
+  pointer operator->() const { return &tables_[table_].slots[index_]; }
+  SwissIterator& operator++() {
+    ++index_;
+    SkipFree();
+    return *this;
+  }
+  SwissIterator operator++(int) {
+    SwissIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const SwissIterator& other) const {
+    return table_ == other.table_ && index_ == other.index_;
+  }
+  bool operator!=(const SwissIterator& other) const {
+    return !(*this == other);
+  }
+
+  const SwissSlots<T>* tables() const { return tables_; }
+  int table() const { return table_; }
+  size_t index() const { return index_; }
+
+ private:
+  const SwissSlots<T>* tables_;
+  // 0 for the current table, 1 for the one being migrated; end() is one
+  // past the last slot of table 1
+  int table_;
+  size_t index_;
+
+  void SkipFree() {
+    if (tables_ == nullptr) return;
+    for (;;) {
+      const SwissSlots<T>& slots = tables_[table_];
+      while (index_ < slots.capacity) {
+        size_t start = index_ & ~size_t(SwissGroup::kWidth - 1);
+        uint32_t full = SwissGroup(slots.ctrl + start).MatchFull() &
+                        (0xFFFFu << (index_ - start));
+        if (full != 0) {
+          index_ = start + __builtin_ctz(full);
+          return;
+        }
+        index_ = start + SwissGroup::kWidth;
+      }
+      if (table_ == 1) {
+        index_ = slots.capacity;
+        return;
+      }
+      table_ = 1;
+      index_ = 0;
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_SWISS_ITERATOR_H_
@@ -0,0 +1,111 @@
+#ifndef SRC_SWISS_TABLE_H_
+#define SRC_SWISS_TABLE_H_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "../avlTree/s21_avl_tree.h"
+#include "s21_swiss_iterator.h"
+
+namespace s21 {
+// Open-addressing hash table in the style of Abseil's Swiss tables, behind
+// unordered_set and unordered_map. Every slot has a control byte holding
+// seven bits of its hash; a lookup compares sixteen of them at once (one
+// SSE2 instruction), and only touches the slots whose byte matches.
+// Probing walks groups of sixteen slots in triangular steps and stops at
+// the first group with an empty slot.
+//
+// Erase leaves a tombstone only when the slot's group is full: a group
+// with an empty slot already ends every probe that reaches it.
+//
+// Growth is incremental. The full table is kept as the old table, and
+// every insert moves up to kMigrateSlots of its slots into the new one,
+// so no single insert pays for the whole rehash. Lookups check both
+// tables until the move is done. Inserts may move elements and so
+// invalidate all iterators; erase invalidates only the erased one.
+template <typename T, typename Hash, typename KeyEqual,
+          typename KeyOfValue = Identity<T>>
+class SwissTable {
+ public:
+  using iterator = SwissIterator<T, false>;
+  using const_iterator = SwissIterator<T, true>;
+  using key_type =
+      std::decay_t<decltype(std::declval<KeyOfValue>()(std::declval<T&>()))>;
+  // Full slots per slot before the table grows
+  static constexpr double kMaxLoadFactor = 0.875;
+
+  SwissTable();
+  SwissTable(const Hash& hash, const KeyEqual& equal);
+  SwissTable(const SwissTable& other);
+  SwissTable(SwissTable&& other) noexcept;
+  SwissTable& operator=(SwissTable other) noexcept;
+  ~SwissTable();
+
+  iterator Begin() const;
+  iterator End() const;
+  size_t Size() const;
+  // Slots of the current table
+  size_t Capacity() const;
+  bool Migrating() const;
+  // Keeps the current table's memory
+  void Clear();
+  void Swap(SwissTable& other) noexcept;
+  // Finishes any migration and makes room for n elements without growth
+  void Reserve(size_t n);
+
+  template <typename K>
+  iterator Find(const K& key) const;
+  template <typename U>
+  std::pair<iterator, bool> InsertUnique(U&& value);
+  // Constructs the element from args only when key is absent
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(const K& key, Args&&... args);
+  void Erase(iterator pos);
+  template <typename K>
+  size_t EraseUnique(const K& key);
+
+  const Hash& GetHash() const;
+  const KeyEqual& GetKeyEqual() const;
+  const KeyOfValue& GetKeyOfValue() const;
+
+ private:
+  using Slots = SwissSlots<T>;
+  static constexpr size_t kGroup = SwissGroup::kWidth;
+  static constexpr size_t kMinCapacity = kGroup;
+  // Old slots moved per insert while migrating
+  static constexpr size_t kMigrateSlots = 2 * kGroup;
+
+  // [0] takes the inserts; [1] is the table being migrated, if any
+  Slots tables_[2];
+  // Old slots before this one have been moved
+  size_t migrated_;
+  size_t size_;
+  Hash hash_;
+  KeyEqual equal_;
+  KeyOfValue key_of_;
+
+  template <typename K>
+  size_t HashOf(const K& key) const;
+  template <typename K>
+  bool FindIn(const Slots& table, const K& key, size_t hash,
+              size_t* index) const;
+  // First empty or deleted slot on the probe sequence of hash
+  static size_t FindFree(const Slots& table, size_t hash);
+  static void MarkFull(Slots& table, size_t index, size_t hash);
+  static void MarkFree(Slots& table, size_t index);
+
+  // Makes the current table the old one, behind a new one of capacity
+  void StartMigration(size_t capacity);
+  void MigrateStep();
+  void FinishMigration();
+  void CopyFrom(const SwissTable& other);
+  static Slots NewSlots(size_t capacity);
+  static void DestroySlots(Slots& table);
+  static void FreeSlots(Slots& table);
+  static size_t SlotsOffset(size_t capacity);
+  static size_t Alignment();
+};
+}  // namespace s21
+
+#endif  // SRC_SWISS_TABLE_H_
@@ -0,0 +1,341 @@
+#ifndef SWISS_TABLE_TPP
+#define SWISS_TABLE_TPP
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "s21_swiss_table.h"
+namespace s21 {
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::SwissTable()
+    : SwissTable(Hash(), KeyEqual()) {}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::SwissTable(const Hash& hash,
+                                                      const KeyEqual& equal)
+    : tables_(), migrated_(0), size_(0), hash_(hash), equal_(equal),
+      key_of_() {}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::SwissTable(const SwissTable& other)
+    : SwissTable(other.hash_, other.equal_) {
+  CopyFrom(other);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::SwissTable(
+    SwissTable&& other) noexcept
+    : SwissTable(other.hash_, other.equal_) {
+  Swap(other);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>&
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::operator=(
+    SwissTable other) noexcept {
+  Swap(other);
+  return *this;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::~SwissTable() {
+  for (Slots& table : tables_) {
+    DestroySlots(table);
+    FreeSlots(table);
+  }
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::iterator
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::Begin() const {
+  return iterator(tables_, 0, 0);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::iterator
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::End() const {
+  return iterator(tables_, 1, tables_[1].capacity);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::Size() const {
+  return size_;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::Capacity() const {
+  return tables_[0].capacity;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+bool SwissTable<T, Hash, KeyEqual, KeyOfValue>::Migrating() const {
+  return tables_[1].capacity != 0;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::Clear() {
+  DestroySlots(tables_[1]);
+  FreeSlots(tables_[1]);
+  Slots& table = tables_[0];
+  DestroySlots(table);
+  if (table.capacity != 0) {
+    std::memset(table.ctrl, kSwissEmpty, table.capacity);
+    table.growth_left = size_t(table.capacity * kMaxLoadFactor);
+  }
+  migrated_ = 0;
+  size_ = 0;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::Swap(
+    SwissTable& other) noexcept {
+  std::swap(tables_, other.tables_);
+  std::swap(migrated_, other.migrated_);
+  std::swap(size_, other.size_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+  std::swap(key_of_, other.key_of_);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::Reserve(size_t n) {
+  FinishMigration();
+  size_t capacity = std::max(kMinCapacity, tables_[0].capacity);
+  while (size_t(capacity * kMaxLoadFactor) < n) capacity *= 2;
+  if (capacity == tables_[0].capacity) return;
+  StartMigration(capacity);
+  FinishMigration();
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename K>
+typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::iterator
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::Find(const K& key) const {
+  size_t hash = HashOf(key);
+  size_t index;
+  for (int t = 0; t < 2; t++) {
+    if (FindIn(tables_[t], key, hash, &index)) {
+      return iterator(tables_, t, index);
+    }
+  }
+  return End();
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename U>
+std::pair<typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::iterator, bool>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::InsertUnique(U&& value) {
+  return TryEmplace(key_of_(value), std::forward<U>(value));
+}
+// The new element goes into the current table. Growing first makes that
+// table the old one, so the new element never has to be migrated.
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename K, typename... Args>
+std::pair<typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::iterator, bool>
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::TryEmplace(const K& key,
+                                                      Args&&... args) {
+  size_t hash = HashOf(key);
+  size_t index;
+  for (int t = 0; t < 2; t++) {
+    if (FindIn(tables_[t], key, hash, &index)) {
+      return {iterator(tables_, t, index), false};
+    }
+  }
+  if (tables_[0].growth_left == 0) {
+    // Migration always ends before the new table fills; this only
+    // guards that bound
+    FinishMigration();
+    size_t capacity = std::max(kMinCapacity, tables_[0].capacity);
+    // Half of the new table stays free, for the inserts that run while
+    // the old one is moved over
+    while (size_t(capacity * kMaxLoadFactor / 2) < size_) capacity *= 2;
+    StartMigration(capacity);
+  }
+  Slots& table = tables_[0];
+  index = FindFree(table, hash);
+  new (&table.slots[index]) T(std::forward<Args>(args)...);
+  MarkFull(table, index, hash);
+  size_++;
+  MigrateStep();
+  return {iterator(tables_, 0, index), true};
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::Erase(iterator pos) {
+  Slots& table = tables_[pos.table()];
+  table.slots[pos.index()].~T();
+  MarkFree(table, pos.index());
+  size_--;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename K>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::EraseUnique(const K& key) {
+  iterator pos = Find(key);
+  if (pos == End()) return 0;
+  Erase(pos);
+  return 1;
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+const Hash& SwissTable<T, Hash, KeyEqual, KeyOfValue>::GetHash() const {
+  return hash_;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+const KeyEqual& SwissTable<T, Hash, KeyEqual, KeyOfValue>::GetKeyEqual()
+    const {
+  return equal_;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+const KeyOfValue& SwissTable<T, Hash, KeyEqual, KeyOfValue>::GetKeyOfValue()
+    const {
+  return key_of_;
+}
+
+// std::hash is the identity for integers; the multiply spreads strided
+// keys over the groups, the shift folds high bits into the seven H2 bits
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename K>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::HashOf(const K& key) const {
+  uint64_t h = uint64_t(hash_(key)) * 0x9E3779B97F4A7C15ull;
+  return size_t(h ^ (h >> 32));
+}
+// H2, the low seven bits, is matched against the control bytes; the rest,
+// H1, picks the first group
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+template <typename K>
+bool SwissTable<T, Hash, KeyEqual, KeyOfValue>::FindIn(const Slots& table,
+                                                       const K& key,
+                                                       size_t hash,
+                                                       size_t* index) const {
+  if (table.capacity == 0) return false;
+  size_t mask = table.capacity / kGroup - 1;
+  size_t group = (hash >> 7) & mask;
+  int8_t h2 = int8_t(hash & 0x7F);
+  for (size_t step = 1;; step++) {
+    SwissGroup ctrl(table.ctrl + group * kGroup);
+    for (uint32_t match = ctrl.Match(h2); match != 0; match &= match - 1) {
+      size_t i = group * kGroup + __builtin_ctz(match);
+      if (equal_(key_of_(table.slots[i]), key)) {
+        *index = i;
+        return true;
+      }
+    }
+    if (ctrl.MatchEmpty() != 0) return false;
+    // Triangular steps visit every group of a power-of-two count
+    group = (group + step) & mask;
+  }
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::FindFree(const Slots& table,
+                                                           size_t hash) {
+  size_t mask = table.capacity / kGroup - 1;
+  size_t group = (hash >> 7) & mask;
+  for (size_t step = 1;; step++) {
+    uint32_t free = SwissGroup(table.ctrl + group * kGroup).MatchFree();
+    if (free != 0) return group * kGroup + __builtin_ctz(free);
+    group = (group + step) & mask;
+  }
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::MarkFull(Slots& table,
+                                                         size_t index,
+                                                         size_t hash) {
+  if (table.ctrl[index] == kSwissEmpty) table.growth_left--;
+  table.ctrl[index] = int8_t(hash & 0x7F);
+}
+// A probe that reaches a group with an empty slot stops there, so another
+// empty slot in that group cannot cut a probe short
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::MarkFree(Slots& table,
+                                                         size_t index) {
+  size_t start = index & ~(kGroup - 1);
+  if (SwissGroup(table.ctrl + start).MatchEmpty() != 0) {
+    table.ctrl[index] = kSwissEmpty;
+    table.growth_left++;
+  } else {
+    table.ctrl[index] = kSwissDeleted;
+  }
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::StartMigration(
+    size_t capacity) {
+  Slots fresh = NewSlots(capacity);
+  tables_[1] = tables_[0];
+  tables_[0] = fresh;
+  migrated_ = 0;
+}
+// Moved slots are freed like erased ones, so that lookups in the old
+// table still find what has not moved yet
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::MigrateStep() {
+  Slots& old = tables_[1];
+  if (old.capacity == 0) return;
+  size_t stop = std::min(migrated_ + kMigrateSlots, old.capacity);
+  for (; migrated_ < stop; migrated_++) {
+    if (old.ctrl[migrated_] < 0) continue;
+    T& slot = old.slots[migrated_];
+    size_t hash = HashOf(key_of_(slot));
+    size_t index = FindFree(tables_[0], hash);
+    new (&tables_[0].slots[index]) T(std::move(slot));
+    MarkFull(tables_[0], index, hash);
+    slot.~T();
+    MarkFree(old, migrated_);
+  }
+  if (migrated_ == old.capacity) {
+    FreeSlots(old);
+    migrated_ = 0;
+  }
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::FinishMigration() {
+  while (Migrating()) MigrateStep();
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::CopyFrom(
+    const SwissTable& other) {
+  if (other.size_ == 0) return;
+  size_t capacity = kMinCapacity;
+  while (size_t(capacity * kMaxLoadFactor) < other.size_) capacity *= 2;
+  tables_[0] = NewSlots(capacity);
+  try {
+    for (iterator it = other.Begin(); it != other.End(); ++it) {
+      size_t hash = HashOf(key_of_(*it));
+      size_t index = FindFree(tables_[0], hash);
+      new (&tables_[0].slots[index]) T(*it);
+      MarkFull(tables_[0], index, hash);
+      size_++;
+    }
+  } catch (...) {
+    DestroySlots(tables_[0]);
+    FreeSlots(tables_[0]);
+    size_ = 0;
+    throw;
+  }
+}
+
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+typename SwissTable<T, Hash, KeyEqual, KeyOfValue>::Slots
+SwissTable<T, Hash, KeyEqual, KeyOfValue>::NewSlots(size_t capacity) {
+  void* raw = ::operator new(SlotsOffset(capacity) + capacity * sizeof(T),
+                             std::align_val_t(Alignment()));
+  Slots table;
+  table.ctrl = static_cast<int8_t*>(raw);
+  table.slots =
+      reinterpret_cast<T*>(static_cast<char*>(raw) + SlotsOffset(capacity));
+  table.capacity = capacity;
+  table.growth_left = size_t(capacity * kMaxLoadFactor);
+  std::memset(table.ctrl, kSwissEmpty, capacity);
+  return table;
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::DestroySlots(Slots& table) {
+  for (size_t i = 0; i < table.capacity; i++) {
+    if (table.ctrl[i] >= 0) table.slots[i].~T();
+  }
+}
+// The elements must have been destroyed or moved out already
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+void SwissTable<T, Hash, KeyEqual, KeyOfValue>::FreeSlots(Slots& table) {
+  if (table.capacity != 0) {
+    ::operator delete(table.ctrl, std::align_val_t(Alignment()));
+  }
+  table = Slots();
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::SlotsOffset(
+    size_t capacity) {
+  return (capacity + alignof(T) - 1) / alignof(T) * alignof(T);
+}
+template <typename T, typename Hash, typename KeyEqual, typename KeyOfValue>
+size_t SwissTable<T, Hash, KeyEqual, KeyOfValue>::Alignment() {
+  return std::max<size_t>(kGroup, alignof(T));
+}
+}  // namespace s21
+#endif  // SWISS_TABLE_TPP
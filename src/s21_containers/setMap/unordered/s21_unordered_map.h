@@ -0,0 +1,106 @@
+#ifndef AVL_UNORDERED_MAP_H_
+#define AVL_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include "../../vector/s21_vector.tpp"
+#include "s21_swiss_table.tpp"
+
+namespace s21 {
+// Hash map on a SwissTable, see unordered_set. Growth moves elements to
+// the new table, and the const key of value_type is copied then.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class unordered_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type =
+      SwissTable<value_type, Hash, KeyEqual, SelectFirst<value_type>>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = size_t;
+
+  unordered_map() = default;
+  explicit unordered_map(size_type capacity, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual());
+  unordered_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last);
+  unordered_map(const unordered_map& m) = default;
+  unordered_map(unordered_map&& m) = default;
+  unordered_map& operator=(const unordered_map& m) = default;
+  unordered_map& operator=(unordered_map&& m) = default;
+  ~unordered_map() = default;
+
+  mapped_type& at(const K& key);
+  const mapped_type& at(const K& key) const;
+  mapped_type& operator[](const K& key);
+  mapped_type& operator[](K&& key);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  // Room for n elements without growing; finishes a running migration
+  void reserve(size_type n);
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const key_type& key, const mapped_type& obj);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj);
+  // The mapped value is built from args only when the key is absent
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const K& key);
+  void swap(unordered_map& other);
+  // Moves over the entries whose keys are new here; the others stay in
+  // other
+  void merge(unordered_map& other);
+  // Iterators would not survive the later inserts: returns whether each
+  // argument was inserted
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const K& key) const;
+  iterator find(const K& key);
+  const_iterator find(const K& key) const;
+  size_type count(const K& key) const;
+
+  hasher hash_function() const;
+  key_equal key_eq() const;
+  const table_type& get_table() const;
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // AVL_UNORDERED_MAP_H_
@@ -0,0 +1,246 @@
+#include "s21_unordered_map.h"
+
+namespace s21 {
+template <typename K, typename V, typename Hash, typename KeyEqual>
+unordered_map<K, V, Hash, KeyEqual>::unordered_map(size_type capacity,
+                                                   const Hash& hash,
+                                                   const KeyEqual& equal)
+    : table_(hash, equal) {
+  table_.Reserve(capacity);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+unordered_map<K, V, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const& items)
+    : unordered_map(items.begin(), items.end()) {}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_map<K, V, Hash, KeyEqual>::unordered_map(InputIt first,
+                                                   InputIt last)
+    : table_() {
+  insert(first, last);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::mapped_type&
+unordered_map<K, V, Hash, KeyEqual>::at(const K& key) {
+  iterator it = table_.Find(key);
+  if (it == table_.End()) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return it->second;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+const typename unordered_map<K, V, Hash, KeyEqual>::mapped_type&
+unordered_map<K, V, Hash, KeyEqual>::at(const K& key) const {
+  iterator it = table_.Find(key);
+  if (it == table_.End()) {
+    throw std::invalid_argument("This key doesn't exist");
+  }
+  return it->second;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::mapped_type&
+unordered_map<K, V, Hash, KeyEqual>::operator[](const K& key) {
+  return try_emplace(key).first->second;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::mapped_type&
+unordered_map<K, V, Hash, KeyEqual>::operator[](K&& key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::iterator
+unordered_map<K, V, Hash, KeyEqual>::begin() {
+  return table_.Begin();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::iterator
+unordered_map<K, V, Hash, KeyEqual>::end() {
+  return table_.End();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::const_iterator
+unordered_map<K, V, Hash, KeyEqual>::begin() const {
+  return table_.Begin();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::const_iterator
+unordered_map<K, V, Hash, KeyEqual>::end() const {
+  return table_.End();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool unordered_map<K, V, Hash, KeyEqual>::empty() const {
+  return table_.Size() == 0;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::size_type
+unordered_map<K, V, Hash, KeyEqual>::size() const {
+  return table_.Size();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::size_type
+unordered_map<K, V, Hash, KeyEqual>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::size_type
+unordered_map<K, V, Hash, KeyEqual>::capacity() const {
+  return table_.Capacity();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+float unordered_map<K, V, Hash, KeyEqual>::load_factor() const {
+  return capacity() == 0 ? 0.0f : float(size()) / float(capacity());
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+float unordered_map<K, V, Hash, KeyEqual>::max_load_factor() const {
+  return float(table_type::kMaxLoadFactor);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void unordered_map<K, V, Hash, KeyEqual>::reserve(size_type n) {
+  table_.Reserve(n);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void unordered_map<K, V, Hash, KeyEqual>::clear() {
+  table_.Clear();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::insert(const value_type& value) {
+  return table_.InsertUnique(value);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::insert(value_type&& value) {
+  return table_.InsertUnique(std::move(value));
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::insert(const key_type& key,
+                                            const mapped_type& obj) {
+  return table_.TryEmplace(key, key, obj);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename InputIt>
+void unordered_map<K, V, Hash, KeyEqual>::insert(InputIt first,
+                                                 InputIt last) {
+  for (; first != last; ++first) {
+    const value_type& value = *first;
+    table_.InsertUnique(value);
+  }
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::insert_or_assign(const key_type& key,
+                                                      M&& obj) {
+  auto result = try_emplace(key, std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::insert_or_assign(key_type&& key,
+                                                      M&& obj) {
+  auto result = try_emplace(std::move(key), std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::try_emplace(const key_type& key,
+                                                 Args&&... args) {
+  return table_.TryEmplace(key, std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::try_emplace(key_type&& key,
+                                                 Args&&... args) {
+  // key is only moved from once its slot is found
+  return table_.TryEmplace(key, std::piecewise_construct,
+                           std::forward_as_tuple(std::move(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<K, V, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, V, Hash, KeyEqual>::emplace(Args&&... args) {
+  return table_.InsertUnique(value_type(std::forward<Args>(args)...));
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void unordered_map<K, V, Hash, KeyEqual>::erase(iterator pos) {
+  table_.Erase(pos);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::size_type
+unordered_map<K, V, Hash, KeyEqual>::erase(const K& key) {
+  return table_.EraseUnique(key);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void unordered_map<K, V, Hash, KeyEqual>::swap(unordered_map& other) {
+  table_.Swap(other.table_);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void unordered_map<K, V, Hash, KeyEqual>::merge(unordered_map& other) {
+  if (this == &other) return;
+  for (auto it = other.table_.Begin(); it != other.table_.End();) {
+    auto next = it;
+    ++next;
+    // Erase only invalidates the erased iterator
+    if (table_.InsertUnique(std::move(*it)).second) other.table_.Erase(it);
+    it = next;
+  }
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename... Args>
+s21::vector<bool> unordered_map<K, V, Hash, KeyEqual>::insert_many(
+    Args&&... args) {
+  s21::vector<bool> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(insert(std::forward<Args>(args)).second), ...);
+  return result;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool unordered_map<K, V, Hash, KeyEqual>::contains(const K& key) const {
+  return table_.Find(key) != table_.End();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::iterator
+unordered_map<K, V, Hash, KeyEqual>::find(const K& key) {
+  return table_.Find(key);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::const_iterator
+unordered_map<K, V, Hash, KeyEqual>::find(const K& key) const {
+  return table_.Find(key);
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::size_type
+unordered_map<K, V, Hash, KeyEqual>::count(const K& key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::hasher
+unordered_map<K, V, Hash, KeyEqual>::hash_function() const {
+  return table_.GetHash();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+typename unordered_map<K, V, Hash, KeyEqual>::key_equal
+unordered_map<K, V, Hash, KeyEqual>::key_eq() const {
+  return table_.GetKeyEqual();
+}
+template <typename K, typename V, typename Hash, typename KeyEqual>
+const typename unordered_map<K, V, Hash, KeyEqual>::table_type&
+unordered_map<K, V, Hash, KeyEqual>::get_table() const {
+  return table_;
+}
+}  // namespace s21
@@ -0,0 +1,88 @@
+#ifndef AVL_UNORDERED_SET_H_
+#define AVL_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <limits>
+
+#include "../../vector/s21_vector.tpp"
+#include "s21_swiss_table.tpp"
+
+namespace s21 {
+// Hash set on a SwissTable: the s21::set interface for exact-match use,
+// so no ordered lookups, node handles or set algebra, plus the usual
+// load_factor, reserve and hash_function. Lookups are expected O(1).
+// An insert may move elements and invalidates all iterators; erase only
+// invalidates the erased one. Elements should be nothrow movable.
+template <typename T, typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>>
+class unordered_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T&;
+  using const_reference = const T&;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type = SwissTable<T, Hash, KeyEqual>;
+  // Elements are keys, so they are never handed out for writing
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  unordered_set() = default;
+  explicit unordered_set(size_type capacity, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual());
+  unordered_set(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  unordered_set(InputIt first, InputIt last);
+  unordered_set(const unordered_set& s) = default;
+  unordered_set(unordered_set&& s) = default;
+  unordered_set& operator=(const unordered_set& s) = default;
+  unordered_set& operator=(unordered_set&& s) = default;
+  ~unordered_set() = default;
+
+  iterator begin() const;
+  iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  // Room for n elements without growing; finishes a running migration
+  void reserve(size_type n);
+
+  void clear();
+  std::pair<iterator, bool> insert(const T& value);
+  std::pair<iterator, bool> insert(T&& value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const T& key);
+  void swap(unordered_set& other);
+  // Moves every element of other over, other ends empty
+  void merge(unordered_set& other);
+  // Iterators would not survive the later inserts: returns whether each
+  // argument was inserted
+  template <typename... Args>
+  s21::vector<bool> insert_many(Args&&... args);
+
+  bool contains(const T& key) const;
+  iterator find(const T& key) const;
+  size_type count(const T& key) const;
+  std::pair<iterator, iterator> equal_range(const T& key) const;
+
+  hasher hash_function() const;
+  key_equal key_eq() const;
+  const table_type& get_table() const;
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // AVL_UNORDERED_SET_H_
@@ -0,0 +1,161 @@
+#include "s21_unordered_set.h"
+
+namespace s21 {
+template <typename T, typename Hash, typename KeyEqual>
+unordered_set<T, Hash, KeyEqual>::unordered_set(size_type capacity,
+                                                const Hash& hash,
+                                                const KeyEqual& equal)
+    : table_(hash, equal) {
+  table_.Reserve(capacity);
+}
+template <typename T, typename Hash, typename KeyEqual>
+unordered_set<T, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const& items)
+    : unordered_set(items.begin(), items.end()) {}
+template <typename T, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_set<T, Hash, KeyEqual>::unordered_set(InputIt first, InputIt last)
+    : table_() {
+  insert(first, last);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::iterator
+unordered_set<T, Hash, KeyEqual>::begin() const {
+  return table_.Begin();
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::iterator
+unordered_set<T, Hash, KeyEqual>::end() const {
+  return table_.End();
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+bool unordered_set<T, Hash, KeyEqual>::empty() const {
+  return table_.Size() == 0;
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::size_type
+unordered_set<T, Hash, KeyEqual>::size() const {
+  return table_.Size();
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::size_type
+unordered_set<T, Hash, KeyEqual>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(T) + 1);
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::size_type
+unordered_set<T, Hash, KeyEqual>::capacity() const {
+  return table_.Capacity();
+}
+template <typename T, typename Hash, typename KeyEqual>
+float unordered_set<T, Hash, KeyEqual>::load_factor() const {
+  return capacity() == 0 ? 0.0f : float(size()) / float(capacity());
+}
+template <typename T, typename Hash, typename KeyEqual>
+float unordered_set<T, Hash, KeyEqual>::max_load_factor() const {
+  return float(table_type::kMaxLoadFactor);
+}
+template <typename T, typename Hash, typename KeyEqual>
+void unordered_set<T, Hash, KeyEqual>::reserve(size_type n) {
+  table_.Reserve(n);
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+void unordered_set<T, Hash, KeyEqual>::clear() {
+  table_.Clear();
+}
+template <typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<T, Hash, KeyEqual>::iterator, bool>
+unordered_set<T, Hash, KeyEqual>::insert(const T& value) {
+  return table_.InsertUnique(value);
+}
+template <typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<T, Hash, KeyEqual>::iterator, bool>
+unordered_set<T, Hash, KeyEqual>::insert(T&& value) {
+  return table_.InsertUnique(std::move(value));
+}
+template <typename T, typename Hash, typename KeyEqual>
+template <typename InputIt>
+void unordered_set<T, Hash, KeyEqual>::insert(InputIt first, InputIt last) {
+  for (; first != last; ++first) table_.InsertUnique(*first);
+}
+template <typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_set<T, Hash, KeyEqual>::iterator, bool>
+unordered_set<T, Hash, KeyEqual>::emplace(Args&&... args) {
+  return table_.InsertUnique(T(std::forward<Args>(args)...));
+}
+template <typename T, typename Hash, typename KeyEqual>
+void unordered_set<T, Hash, KeyEqual>::erase(iterator pos) {
+  table_.Erase({pos.tables(), pos.table(), pos.index()});
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::size_type
+unordered_set<T, Hash, KeyEqual>::erase(const T& key) {
+  return table_.EraseUnique(key);
+}
+template <typename T, typename Hash, typename KeyEqual>
+void unordered_set<T, Hash, KeyEqual>::swap(unordered_set& other) {
+  table_.Swap(other.table_);
+}
+template <typename T, typename Hash, typename KeyEqual>
+void unordered_set<T, Hash, KeyEqual>::merge(unordered_set& other) {
+  if (this == &other) return;
+  table_.Reserve(size() + other.size());
+  for (auto it = other.table_.Begin(); it != other.table_.End(); ++it) {
+    table_.InsertUnique(std::move(*it));
+  }
+  other.clear();
+}
+template <typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+s21::vector<bool> unordered_set<T, Hash, KeyEqual>::insert_many(
+    Args&&... args) {
+  s21::vector<bool> result;
+  result.reserve(sizeof...(args));
+  (result.push_back(insert(std::forward<Args>(args)).second), ...);
+  return result;
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+bool unordered_set<T, Hash, KeyEqual>::contains(const T& key) const {
+  return table_.Find(key) != table_.End();
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::iterator
+unordered_set<T, Hash, KeyEqual>::find(const T& key) const {
+  return table_.Find(key);
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::size_type
+unordered_set<T, Hash, KeyEqual>::count(const T& key) const {
+  return contains(key) ? 1 : 0;
+}
+template <typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<T, Hash, KeyEqual>::iterator,
+          typename unordered_set<T, Hash, KeyEqual>::iterator>
+unordered_set<T, Hash, KeyEqual>::equal_range(const T& key) const {
+  iterator pos = find(key);
+  if (pos == end()) return {pos, pos};
+  iterator next = pos;
+  return {pos, ++next};
+}
+
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::hasher
+unordered_set<T, Hash, KeyEqual>::hash_function() const {
+  return table_.GetHash();
+}
+template <typename T, typename Hash, typename KeyEqual>
+typename unordered_set<T, Hash, KeyEqual>::key_equal
+unordered_set<T, Hash, KeyEqual>::key_eq() const {
+  return table_.GetKeyEqual();
+}
+template <typename T, typename Hash, typename KeyEqual>
+const typename unordered_set<T, Hash, KeyEqual>::table_type&
+unordered_set<T, Hash, KeyEqual>::get_table() const {
+  return table_;
+}
+}  // namespace s21
@@ -24,6 +24,7 @@ class vector {
   using const_iterator = VectorConstIterator<T>;
   using size_type = std::size_t;
   using pointer = T *;
+  using const_pointer = const T *;
 
  public:
   // Vector Member functions
@@ -41,6 +42,7 @@ class vector {
   const_reference front();
   const_reference back();
   pointer data();
+  const_pointer data() const;
 
   // Vector Iterators
   iterator begin();
@@ -61,6 +63,7 @@ class vector {
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(vector &other);
 
@@ -1,3 +1,5 @@
+#ifndef VECTOR_TPP
+#define VECTOR_TPP
 #include "s21_vector.h"
 namespace s21 {
 // Vector Member functions
@@ -97,6 +99,11 @@ typename vector<value_type>::pointer vector<value_type>::data() {
   return container_;
 }
 
+template <class value_type>
+typename vector<value_type>::const_pointer vector<value_type>::data() const {
+  return container_;
+}
+
 // Vector Iterators
 template <class value_type>
 typename vector<value_type>::iterator vector<value_type>::begin() {
@@ -205,11 +212,26 @@ void vector<value_type>::erase(iterator pos) {
 template <class value_type>
 void vector<value_type>::push_back(const_reference value) {
   if (this->size_ >= this->capacity_) {
+    // value may be an element of the buffer that add_memory frees
+    value_type copy = value;
     add_memory(0, false);
+    this->container_[this->size_++] = copy;
+    return;
   }
   this->container_[this->size_++] = value;
 }
 
+template <class value_type>
+void vector<value_type>::push_back(value_type&& value) {
+  if (this->size_ >= this->capacity_) {
+    value_type moved = std::move(value);
+    add_memory(0, false);
+    this->container_[this->size_++] = std::move(moved);
+    return;
+  }
+  this->container_[this->size_++] = std::move(value);
+}
+
 template <class value_type>
 void vector<value_type>::pop_back() {
   this->size_ > 0 ? this->size_-- : 0;
@@ -225,8 +247,9 @@ void vector<value_type>::swap(vector& other) {
 // Helpers
 template <class value_type>
 void vector<value_type>::copy_vector(const vector& v) {
+  // Only size_ elements are allocated, so that is the capacity
   this->size_ = v.size_;
-  this->capacity_ = v.capacity_;
+  this->capacity_ = v.size_;
   this->container_ = new value_type[this->size_];
   for (size_type i = 0; i < this->size_; i++) {
     this->container_[i] = v.container_[i];
@@ -266,4 +289,5 @@ void vector<value_type>::remove() {
   this->container_ = nullptr;
   this->size_ = this->capacity_ = 0;
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
+#endif  // VECTOR_TPP
@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
 #include <list>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stack>
+#include <string_view>
 #include <vector>
 
 #include "./s21_containers/s21_containers.h"
@@ -474,6 +478,25 @@ TEST(VectorTest, Modifiers_push_back_2) {
   EXPECT_EQ(s21_v.at(5), std_v.at(5));
 }
 
+TEST(VectorTest, Modifiers_push_back_3) {
+  s21::vector<std::string> s21_v{"a", "b"};
+  s21_v.reserve(8);
+  s21::vector<std::string> s21_copy(s21_v);
+  std::vector<std::string> std_v{"a", "b"};
+  std::vector<std::string> std_copy(std_v);
+
+  EXPECT_EQ(s21_copy.capacity(), std_copy.capacity());
+  s21_copy.push_back(s21_copy.at(0));
+  s21_copy.push_back(s21_copy.at(2));
+  std_copy.push_back(std_copy.at(0));
+  std_copy.push_back(std_copy.at(2));
+
+  EXPECT_EQ(s21_copy.size(), std_copy.size());
+  for (size_t i = 0; i < std_copy.size(); i++) {
+    EXPECT_EQ(s21_copy.at(i), std_copy.at(i));
+  }
+}
+
 TEST(VectorTest, Modifiers_pop_back_1) {
   s21::vector<int> s21_v{1, 2};
 
@@ -889,9 +912,881 @@ TEST(AVLTreeTest, RemoveTest) {
   // Remove a leaf node
   tree.Remove(50);
 }
+TEST(AVLTreeTest, InsertReturnsNode) {
+  s21::AVLTree<int, int> tree;
+  s21::Node<int, int>* node = tree.Insert(10);
+  EXPECT_TRUE(tree.GetInserted());
+  EXPECT_EQ(node->key, 10);
+  tree.Insert(5);
+  tree.Insert(15);
+  EXPECT_EQ(tree.Insert(10), node);
+  EXPECT_FALSE(tree.GetInserted());
+  EXPECT_EQ(tree.Search(15)->key, 15);
+  EXPECT_EQ(tree.Search(7), nullptr);
+}
+TEST(AVLTreeTest, RemoveKeepsOrder) {
+  s21::set<int> s;
+  for (int i = 0; i < 64; i++) s.insert(i);
+  for (int i = 0; i < 64; i += 2) s.erase(s.find(i));
+  int expected = 1;
+  for (auto it = s.begin(); it != s.end(); ++it, expected += 2) {
+    EXPECT_EQ(*it, expected);
+  }
+  EXPECT_EQ(expected, 65);
+  EXPECT_EQ(s.size(), 32);
+}
+TEST(setTest, CustomCompare) {
+  s21::set<int, std::greater<int>> s = {1, 5, 3, 4, 2};
+  int expected = 5;
+  for (auto it = s.begin(); it != s.end(); ++it, --expected) {
+    EXPECT_EQ(*it, expected);
+  }
+  EXPECT_TRUE(s.contains(3));
+  EXPECT_EQ(s.count_less(3), 2);
+  EXPECT_EQ(*s.select(0), 5);
+}
+TEST(setTest, OneComparePerLevel) {
+  size_t calls = 0;
+  auto less = [&calls](int a, int b) {
+    ++calls;
+    return a < b;
+  };
+  s21::set<int, decltype(less)> s(less);
+  for (int i = 0; i < 1023; i++) s.insert(i);
+  calls = 0;
+  s.find(511);
+  // a perfectly balanced tree of 1023 nodes has 10 levels
+  EXPECT_LE(calls, 12);
+}
+TEST(setTest, TransparentFind) {
+  s21::set<std::string, std::less<>> s = {"alpha", "beta", "gamma"};
+  std::string_view key = "beta";
+  EXPECT_TRUE(s.contains(key));
+  EXPECT_TRUE(s.contains("gamma"));
+  EXPECT_FALSE(s.contains("delta"));
+  EXPECT_EQ(*s.find(key), "beta");
+  EXPECT_EQ(s.find("delta"), s.end());
+}
+TEST(mapTest, TransparentFind) {
+  s21::map<std::string, int, std::less<>> map = {{"one", 1}, {"two", 2}};
+  std::string_view key = "two";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_TRUE(map.contains("one"));
+  EXPECT_FALSE(map.contains("three"));
+  EXPECT_EQ(map.find(key)->second, 2);
+  EXPECT_EQ(map.find("three"), map.end());
+}
+TEST(mapTest, CustomCompare) {
+  s21::map<int, std::string, std::greater<int>> map = {
+      {1, "one"}, {2, "two"}, {3, "three"}};
+  EXPECT_EQ(map.begin()->first, 3);
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_EQ(map.rank(1), 2);
+}
+TEST(mapTest, EmptyMapAccess) {
+  s21::map<int, std::string> map;
+  EXPECT_THROW(map.at(1), std::invalid_argument);
+  map[1] = "one";
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(1), "one");
+}
+TEST(mapTest, InsertDuplicateKey) {
+  s21::map<int, std::string> map = {{1, "one"}, {2, "two"}};
+  auto [it, inserted] = map.insert(2, "TWO");
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->first, 2);
+  EXPECT_EQ(it->second, "two");
+  EXPECT_EQ(map.size(), 2);
+}
+TEST(mapTest, LookupIsTreeDescent) {
+  size_t calls = 0;
+  auto less = [&calls](int a, int b) {
+    ++calls;
+    return a < b;
+  };
+  s21::map<int, int, decltype(less)> map(less);
+  for (int i = 0; i < 1023; i++) map.insert(i, i);
+  calls = 0;
+  map.at(700);
+  map[701] = 1;
+  map.contains(702);
+  map.insert_or_assign(703, 3);
+  map.insert(704, 4);
+  EXPECT_LE(calls, 5 * 12);
+  EXPECT_EQ(map.at(703), 3);
+  EXPECT_EQ(map.at(704), 704);
+}
+TEST(AVLTreeTest, ErasedNodeIsReused) {
+  s21::AVLTree<int, int> tree;
+  for (int i = 0; i < 100; i++) tree.Insert(i);
+  s21::Node<int, int>* node = tree.Search(42);
+  tree.Remove(42);
+  EXPECT_EQ(tree.Insert(1000), node);
+}
+TEST(AVLTreeTest, ClearDestroysKeys) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::set<std::shared_ptr<int>> s;
+    for (int i = 0; i < 100; i++) s.insert(counter);
+    s.insert(std::make_shared<int>(1));
+    EXPECT_EQ(counter.use_count(), 2);
+    s.clear();
+    EXPECT_EQ(counter.use_count(), 1);
+    s.insert(counter);
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+TEST(setTest, ClearAndRefill) {
+  s21::set<std::string> s;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 500; i++) s.insert(std::to_string(i));
+    EXPECT_EQ(s.size(), 500);
+    s.clear();
+    EXPECT_TRUE(s.empty());
+  }
+}
+TEST(setTest, InsertMany) {
+  s21::set<int> s = {10, 20, 30};
+  auto result = s.insert_many(25, 10, 5, 25, 40);
+  ASSERT_EQ(result.size(), 5);
+  bool inserted[] = {true, false, true, false, true};
+  int keys[] = {25, 10, 5, 25, 40};
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(result[i].second, inserted[i]);
+    EXPECT_EQ(*result[i].first, keys[i]);
+  }
+  EXPECT_EQ(result[0].first, result[3].first);
+  EXPECT_EQ(s.size(), 6);
+  int expected[] = {5, 10, 20, 25, 30, 40};
+  int i = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) EXPECT_EQ(*it, expected[i++]);
+}
+TEST(setTest, SortedRangeBuildsBalancedTree) {
+  std::vector<int> sorted(1023);
+  for (int i = 0; i < 1023; i++) sorted[i] = i;
+  s21::set<int> s(sorted.begin(), sorted.end());
+  EXPECT_EQ(s.size(), 1023);
+  EXPECT_EQ(s.get_tree().GetRoot()->height, 10);
+  for (int i = 0; i < 1023; i++) EXPECT_EQ(*s.select(i), i);
+}
+TEST(setTest, UnsortedRangeMatchesStdSet) {
+  std::vector<int> batch;
+  for (int i = 0; i < 3000; i++) batch.push_back((i * 7919) % 1201);
+  s21::set<int> s(batch.begin(), batch.end());
+  std::set<int> expected(batch.begin(), batch.end());
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) EXPECT_EQ(*it++, key);
+  EXPECT_LE(s.get_tree().GetRoot()->height, 11);
+}
+TEST(mapTest, InsertMany) {
+  s21::map<int, std::string> m = {{3, "c"}, {1, "a"}, {1, "x"}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m.at(1), "a");
+  auto kept = m.find(3);
+  auto result = m.insert_many(std::make_pair(2, "b"), std::make_pair(3, "z"),
+                              std::make_pair(4, "d"));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(result[1].first, kept);
+  EXPECT_TRUE(result[2].second);
+  EXPECT_EQ(m.size(), 4);
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ(kept->second, "c");
+  int i = 1;
+  for (auto it = m.begin(); it != m.end(); ++it) EXPECT_EQ(it->first, i++);
+}
+// Checks heights, balance, subtree sizes and parent links; returns height
+template <typename T, typename V>
+static int CheckAVL(const s21::Node<T, V>* node,
+                    const s21::Node<T, V>* parent) {
+  if (node == nullptr) return 0;
+  EXPECT_EQ(node->parent, parent);
+  int hl = CheckAVL(node->left, node);
+  int hr = CheckAVL(node->right, node);
+  size_t size = 1 + (node->left ? node->left->size_ : 0) +
+                (node->right ? node->right->size_ : 0);
+  EXPECT_EQ(node->size_, size);
+  EXPECT_LE(std::abs(hl - hr), 1);
+  EXPECT_EQ(node->height, std::max(hl, hr) + 1);
+  return node->height;
+}
+static std::vector<int> Keys(int count, int stride, int modulo) {
+  std::vector<int> keys;
+  for (int i = 0; i < count; i++) keys.push_back(i * stride % modulo);
+  return keys;
+}
+TEST(setTest, SetAlgebraMatchesStd) {
+  std::vector<int> big = Keys(2000, 7919, 3001);
+  std::vector<int> small = Keys(40, 104729, 3001);
+  std::set<int> a(big.begin(), big.end());
+  std::set<int> b(small.begin(), small.end());
+  for (int op = 0; op < 3; op++) {
+    for (int swap_sides = 0; swap_sides < 2; swap_sides++) {
+      const std::set<int>& x = swap_sides ? b : a;
+      const std::set<int>& y = swap_sides ? a : b;
+      s21::set<int> s1(x.begin(), x.end());
+      s21::set<int> s2(y.begin(), y.end());
+      std::vector<int> expected;
+      if (op == 0) {
+        s1.set_union(s2);
+        std::set_union(x.begin(), x.end(), y.begin(), y.end(),
+                       std::back_inserter(expected));
+      } else if (op == 1) {
+        s1.set_intersection(s2);
+        std::set_intersection(x.begin(), x.end(), y.begin(), y.end(),
+                              std::back_inserter(expected));
+      } else {
+        s1.set_difference(s2);
+        std::set_difference(x.begin(), x.end(), y.begin(), y.end(),
+                            std::back_inserter(expected));
+      }
+      EXPECT_TRUE(s2.empty());
+      ASSERT_EQ(s1.size(), expected.size());
+      auto it = s1.begin();
+      for (int key : expected) EXPECT_EQ(*it++, key);
+      CheckAVL<int, int>(s1.get_tree().GetRoot(), nullptr);
+      s1.insert(5000);
+      EXPECT_TRUE(s1.contains(5000));
+    }
+  }
+}
+TEST(setTest, Split) {
+  s21::set<std::string> upper;
+  {
+    std::vector<int> keys = Keys(500, 1, 500);
+    s21::set<std::string> s;
+    for (int key : keys) s.insert(std::to_string(1000 + key));
+    upper = s.split("1200");
+    EXPECT_EQ(s.size(), 200);
+    EXPECT_EQ(*--s.end(), "1199");
+    CheckAVL<std::string, std::string>(s.get_tree().GetRoot(), nullptr);
+  }
+  EXPECT_EQ(upper.size(), 300);
+  EXPECT_EQ(*upper.begin(), "1200");
+  CheckAVL<std::string, std::string>(upper.get_tree().GetRoot(), nullptr);
+  upper.erase(upper.find("1300"));
+  upper.insert("2000");
+  EXPECT_EQ(upper.size(), 300);
+  EXPECT_EQ(upper.rank("2000"), 299);
+}
+TEST(setTest, MergeConsumesOther) {
+  s21::set<int> s1 = {1, 3, 5};
+  s21::set<int> s2 = {2, 3, 4};
+  s1.merge(s2);
+  EXPECT_EQ(s1.size(), 5);
+  EXPECT_TRUE(s2.empty());
+  s1.merge(s1);
+  EXPECT_EQ(s1.size(), 5);
+}
+TEST(mapTest, SetAlgebraKeepsOwnValues) {
+  s21::map<int, std::string> m1 = {{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::map<int, std::string> m2 = {{2, "x"}, {4, "y"}};
+  m1.set_union(m2);
+  EXPECT_EQ(m1.size(), 4);
+  EXPECT_EQ(m1.at(2), "b");
+  EXPECT_EQ(m1.at(4), "y");
+  s21::map<int, std::string> m3 = {{2, "z"}, {4, "z"}, {9, "z"}};
+  m1.set_intersection(m3);
+  EXPECT_EQ(m1.size(), 2);
+  EXPECT_EQ(m1.at(2), "b");
+  s21::map<int, std::string> m4 = {{4, "w"}};
+  m1.set_difference(m4);
+  EXPECT_EQ(m1.size(), 1);
+  s21::map<int, std::string> rest = m1.split(0);
+  EXPECT_TRUE(m1.empty());
+  EXPECT_EQ(rest.at(2), "b");
+}
+TEST(setTest, HintedInsert) {
+  int calls = 0;
+  auto less = [&calls](int a, int b) {
+    calls++;
+    return a < b;
+  };
+  s21::set<int, decltype(less)> s(less);
+  for (int i = 0; i < 1000; i++) s.insert(s.end(), i);
+  EXPECT_LE(calls, 4 * 1000);
+  auto hint = s.find(500);
+  s.erase(s.find(499));
+  calls = 0;
+  auto it = s.insert(hint, 499);
+  EXPECT_EQ(*it, 499);
+  EXPECT_LE(calls, 4);
+  s.erase(s.find(501));
+  it = s.insert(hint, 501);
+  EXPECT_EQ(*it, 501);
+  EXPECT_EQ(*s.insert(s.begin(), 700), 700);
+  EXPECT_EQ(*s.insert(s.begin(), 2000), 2000);
+  EXPECT_EQ(*s.emplace_hint(s.end(), 1500), 1500);
+  EXPECT_EQ(s.size(), 1002);
+  int expected = 0;
+  for (auto i = s.begin(); *i < 1000; ++i) EXPECT_EQ(*i, expected++);
+  CheckAVL<int, int>(s.get_tree().GetRoot(), nullptr);
+}
+TEST(setTest, FingerSearch) {
+  int calls = 0;
+  auto less = [&calls](int a, int b) {
+    calls++;
+    return a < b;
+  };
+  s21::set<int, decltype(less)> s(less);
+  for (int i = 0; i < 4096; i += 2) s.insert(i);
+  for (int from = 0; from < 4096; from += 254) {
+    auto finger = s.find(from);
+    for (int key = from - 40; key < from + 40; key++) {
+      auto found = s.find(finger, key);
+      if (key >= 0 && key < 4096 && key % 2 == 0) {
+        ASSERT_NE(found, s.end());
+        EXPECT_EQ(*found, key);
+      } else {
+        EXPECT_EQ(found, s.end());
+      }
+    }
+  }
+  auto finger = s.find(1000);
+  calls = 0;
+  EXPECT_EQ(*s.find(finger, 1002), 1002);
+  EXPECT_EQ(*s.find(++finger, 1004), 1004);
+  EXPECT_LE(calls, 12);
+  EXPECT_EQ(*s.find(s.end(), 8), 8);
+}
+TEST(mapTest, HintedInsert) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 100; i++) m.insert(m.end(), {i, std::to_string(i)});
+  auto it = m.emplace_hint(m.find(50), 50, "dup");
+  EXPECT_EQ(it->second, "50");
+  it = m.emplace_hint(m.begin(), -1, "first");
+  EXPECT_EQ(m.begin(), it);
+  EXPECT_EQ(m.size(), 101);
+  EXPECT_EQ(m.find(m.find(10), 12)->second, "12");
+}
+TEST(setTest, Bounds) {
+  s21::set<int> s = {10, 20, 30, 40};
+  std::set<int> expected = {10, 20, 30, 40};
+  for (int key = 5; key <= 45; key++) {
+    auto lower = s.lower_bound(key);
+    auto upper = s.upper_bound(key);
+    if (expected.lower_bound(key) == expected.end()) {
+      EXPECT_EQ(lower, s.end());
+    } else {
+      EXPECT_EQ(*lower, *expected.lower_bound(key));
+    }
+    if (expected.upper_bound(key) == expected.end()) {
+      EXPECT_EQ(upper, s.end());
+    } else {
+      EXPECT_EQ(*upper, *expected.upper_bound(key));
+    }
+  }
+  auto equal = s.equal_range(20);
+  EXPECT_EQ(*equal.first, 20);
+  EXPECT_EQ(*equal.second, 30);
+  equal = s.equal_range(25);
+  EXPECT_EQ(equal.first, equal.second);
+  equal = s.equal_range(40);
+  EXPECT_EQ(equal.second, s.end());
+}
+TEST(setTest, RangeView) {
+  s21::set<int> s;
+  for (int i = 0; i < 100; i++) s.insert(i * 3);
+  std::vector<int> seen;
+  for (int key : s.range(10, 31)) seen.push_back(key);
+  EXPECT_EQ(seen, std::vector<int>({12, 15, 18, 21, 24, 27, 30}));
+  EXPECT_TRUE(s.range(31, 10).empty());
+  EXPECT_TRUE(s.range(13, 14).empty());
+  seen.clear();
+  for (int key : s.range(290, 1000)) seen.push_back(key);
+  EXPECT_EQ(seen, std::vector<int>({291, 294, 297}));
+}
+TEST(mapTest, Bounds) {
+  s21::map<int, std::string> m = {{1, "a"}, {5, "b"}, {9, "c"}};
+  EXPECT_EQ(m.lower_bound(5)->second, "b");
+  EXPECT_EQ(m.upper_bound(5)->second, "c");
+  EXPECT_EQ(m.lower_bound(10), m.end());
+  auto equal = m.equal_range(1);
+  EXPECT_EQ(equal.first->second, "a");
+  EXPECT_EQ(equal.second->first, 5);
+  std::string window;
+  for (const auto& entry : m.range(2, 9)) window += entry.second;
+  EXPECT_EQ(window, "b");
+}
+TEST(setTest, IteratorJumps) {
+  s21::set<int> s;
+  for (int i = 0; i < 1000; i++) s.insert(i * 7 % 1000);
+  for (size_t k = 0; k < 1000; k += 37) {
+    auto it = s.begin() + k;
+    EXPECT_EQ(*it, int(k));
+    EXPECT_EQ(it - s.begin(), int(k));
+    EXPECT_EQ(s21::distance(it, s.end()), int(1000 - k));
+    EXPECT_EQ(*(s.end() - (1000 - k)), int(k));
+    if (k + 5 < 1000) {
+      EXPECT_EQ(*(it + 5 - 3), int(k) + 2);
+    }
+  }
+  EXPECT_EQ(s.begin() + 1000, s.end());
+  EXPECT_EQ(s.begin() + 5000, s.end());
+  EXPECT_EQ(s.begin() - 1, s.end());
+  auto it = s.begin();
+  it += 10;
+  it -= 4;
+  EXPECT_EQ(*it, 6);
+  EXPECT_EQ(*--(s.begin() + 3), 2);
+  EXPECT_EQ(s.end() - s.end(), 0);
+}
+TEST(mapTest, PageByOffset) {
+  s21::map<int, int> m;
+  for (int i = 0; i < 500; i++) m.insert(i, i * i);
+  auto page = m.begin() + 250;
+  EXPECT_EQ(page->first, 250);
+  EXPECT_EQ(page->second, 62500);
+  EXPECT_EQ(distance(m.begin(), page), 250);
+}
+// Jumps find the root through the node, whose tree may have changed
+TEST(setTest, IteratorJumpsAfterSwapAndMerge) {
+  s21::set<int> a = {1, 2, 3};
+  s21::set<int> b = {10, 20, 30, 40};
+  auto it = a.find(2);
+  a.swap(b);
+  EXPECT_EQ(*(it + 1), 3);
+  EXPECT_EQ(*(it - 1), 1);
+  EXPECT_EQ(it + 2, b.end());
+  EXPECT_EQ(it - b.begin(), 1);
+  s21::map<int, int> m = {{1, 1}, {5, 5}};
+  s21::map<int, int> n = {{2, 2}, {3, 3}, {4, 4}};
+  auto jt = n.find(3);
+  m.merge(n);
+  EXPECT_EQ((jt + 1)->first, 4);
+  EXPECT_EQ((jt - 2)->first, 1);
+  EXPECT_EQ((jt + 2)->first, 5);
+  EXPECT_EQ(jt + 3, m.end());
+  EXPECT_EQ(s21::distance(m.begin(), jt), 2);
+}
+TEST(setTest, CachedEnds) {
+  s21::set<int> s;
+  EXPECT_EQ(s.begin(), s.end());
+  std::set<int> expected;
+  for (int i = 0; i < 3000; i++) {
+    int key = (i * 7919) % 997;
+    if (i % 3 == 2) {
+      s.erase(s.find(key));
+      expected.erase(key);
+    } else {
+      s.insert(key);
+      expected.insert(key);
+    }
+    if (!expected.empty()) {
+      ASSERT_EQ(*s.begin(), *expected.begin());
+      ASSERT_EQ(*--s.end(), *expected.rbegin());
+      ASSERT_EQ(*s.rbegin(), *expected.rbegin());
+    }
+  }
+  auto missing = s.find(5000);
+  EXPECT_EQ(*--missing, *expected.rbegin());
+  std::vector<int> reversed(s.rbegin(), s.rend());
+  EXPECT_TRUE(std::equal(reversed.begin(), reversed.end(), expected.rbegin()));
+  s21::set<int> upper = s.split(500);
+  EXPECT_LT(*--s.end(), 500);
+  EXPECT_GE(*upper.begin(), 500);
+  s.clear();
+  EXPECT_EQ(s.begin(), s.end());
+  s.insert(1);
+  EXPECT_EQ(*--s.end(), 1);
+}
+TEST(mapTest, CachedEnds) {
+  s21::map<int, int> m = {{3, 30}, {1, 10}, {2, 20}};
+  EXPECT_EQ(m.begin()->first, 1);
+  EXPECT_EQ((--m.end())->second, 30);
+  EXPECT_EQ(m.rbegin()->first, 3);
+  m.erase(m.find(3));
+  EXPECT_EQ(m.rbegin()->first, 2);
+  s21::map<int, int> copy(m);
+  EXPECT_EQ((--copy.end())->first, 2);
+  // end() comes from the tree it is asked of, whatever moved where
+  s21::map<int, int> other = {{7, 70}, {8, 80}};
+  auto kept = m.find(2);
+  m.swap(other);
+  EXPECT_EQ((--m.end())->first, 8);
+  EXPECT_EQ((--other.end())->first, 2);
+  copy.merge(m);
+  EXPECT_EQ((--copy.end())->first, 8);
+  EXPECT_EQ(++kept, other.end());
+  s21::map<int, int> moved(std::move(copy));
+  EXPECT_EQ((moved.end() - 3)->first, 2);
+}
+// Counts how often values are built and copied
+struct Tracked {
+  static int built;
+  static int copies;
+  int id;
+  explicit Tracked(int i = 0) : id(i) { ++built; }
+  Tracked(const Tracked& other) : id(other.id) { ++copies; }
+  Tracked(Tracked&& other) noexcept : id(other.id) {}
+  Tracked& operator=(const Tracked& other) {
+    id = other.id;
+    ++copies;
+    return *this;
+  }
+  Tracked& operator=(Tracked&&) = default;
+  bool operator<(const Tracked& other) const { return id < other.id; }
+};
+int Tracked::built = 0;
+int Tracked::copies = 0;
+TEST(setTest, EmplaceMoveOnly) {
+  s21::set<std::unique_ptr<int>> s;
+  auto first = std::make_unique<int>(1);
+  int* raw = first.get();
+  auto [it, inserted] = s.insert(std::move(first));
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->get(), raw);
+  EXPECT_TRUE(s.emplace(new int(2)).second);
+  s.emplace_hint(s.end(), new int(3));
+  EXPECT_EQ(s.size(), 3U);
+  s21::set<Tracked> t;
+  Tracked::built = Tracked::copies = 0;
+  t.emplace(5);
+  t.emplace_hint(t.end(), 7);
+  EXPECT_FALSE(t.emplace(5).second);
+  t.insert(Tracked(9));
+  t.insert(t.begin(), Tracked(1));
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::built, 5);
+  EXPECT_EQ(t.size(), 4U);
+  EXPECT_EQ(t.begin()->id, 1);
+  CheckAVL<Tracked, Tracked>(t.get_tree().GetRoot(), nullptr);
+}
+TEST(mapTest, TryEmplaceMoveOnly) {
+  s21::map<int, std::unique_ptr<int>> m;
+  auto value = std::make_unique<int>(10);
+  EXPECT_TRUE(m.try_emplace(1, std::move(value)).second);
+  EXPECT_EQ(value, nullptr);
+  auto other = std::make_unique<int>(20);
+  EXPECT_FALSE(m.try_emplace(1, std::move(other)).second);
+  // a failed try_emplace leaves its arguments alone
+  ASSERT_NE(other, nullptr);
+  EXPECT_EQ(*m.at(1), 10);
+  EXPECT_FALSE(m.insert_or_assign(1, std::move(other)).second);
+  EXPECT_EQ(*m.at(1), 20);
+  EXPECT_TRUE(m.emplace(2, std::make_unique<int>(2)).second);
+  EXPECT_FALSE(m.emplace(2, std::make_unique<int>(3)).second);
+  m.emplace_hint(m.end(), 3, std::make_unique<int>(3));
+  m.insert(std::make_pair(4, std::make_unique<int>(4)));
+  m[5] = std::make_unique<int>(5);
+  EXPECT_EQ(m.size(), 5U);
+  EXPECT_EQ(*m[2], 2);
+  EXPECT_EQ(*(--m.end())->second, 5);
+}
+TEST(mapTest, EmplaceBuildsOnce) {
+  s21::map<std::string, Tracked> m;
+  Tracked::built = Tracked::copies = 0;
+  m.try_emplace("a", 1);
+  m.try_emplace("a", 2);
+  m.emplace(std::piecewise_construct, std::forward_as_tuple("b"),
+            std::forward_as_tuple(2));
+  m.insert_or_assign("c", Tracked(3));
+  m.insert_or_assign("c", Tracked(4));
+  m["d"].id = 5;
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::built, 5);
+  EXPECT_EQ(m.at("a").id, 1);
+  EXPECT_EQ(m.at("c").id, 4);
+  std::string key = "e";
+  m.try_emplace(std::move(key), 6);
+  EXPECT_EQ(m.at("e").id, 6);
+  EXPECT_EQ(m.size(), 5U);
+}
+TEST(setTest, ExtractInsertNode) {
+  s21::set<std::string> a = {"x", "y", "z"};
+  s21::set<std::string> b = {"y"};
+  const std::string* address = &*a.find("x");
+  auto node = a.extract("x");
+  ASSERT_FALSE(node.empty());
+  EXPECT_EQ(node.value(), "x");
+  EXPECT_TRUE(a.extract("missing").empty());
+  auto result = b.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, address);
+  auto duplicate = b.insert(a.extract(a.find("y")));
+  EXPECT_FALSE(duplicate.inserted);
+  EXPECT_EQ(duplicate.node.value(), "y");
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 2U);
+  CheckAVL<std::string, std::string>(a.get_tree().GetRoot(), nullptr);
+}
+TEST(mapTest, ExtractOutlivesSource) {
+  s21::map<int, std::string>::node_type node;
+  s21::map<int, std::string> target;
+  {
+    s21::map<int, std::string> source = {{1, "a"}, {2, "b"}, {3, "c"}};
+    s21::map<int, std::string> donor = {{4, "d"}};
+    source.set_union(donor);
+    node = source.extract(4);
+  }
+  EXPECT_EQ(node.key(), 4);
+  node.mapped() = "e";
+  EXPECT_TRUE(target.insert(std::move(node)).inserted);
+  target.clear();
+  target.insert({5, "f"});
+  EXPECT_EQ(target.at(5), "f");
+}
+TEST(mapTest, MergeRelinksNodes) {
+  s21::map<int, Tracked> a;
+  s21::map<int, Tracked> b;
+  for (int i = 0; i < 300; i += 2) a.try_emplace(i, i);
+  for (int i = 0; i < 300; i += 3) b.try_emplace(i, -i);
+  const Tracked* moved = &b.at(3);
+  Tracked::built = Tracked::copies = 0;
+  a.merge(b);
+  EXPECT_EQ(Tracked::built + Tracked::copies, 0);
+  EXPECT_EQ(a.size(), 200U);
+  // keys present in both stay behind with their own values
+  EXPECT_EQ(b.size(), 50U);
+  EXPECT_EQ(b.at(6).id, -6);
+  EXPECT_EQ(a.at(6).id, 6);
+  EXPECT_EQ(&a.at(3), moved);
+  CheckAVL<std::pair<const int, Tracked>, Tracked>(a.get_tree().GetRoot(),
+                                                   nullptr);
+  CheckAVL<std::pair<const int, Tracked>, Tracked>(b.get_tree().GetRoot(),
+                                                   nullptr);
+  EXPECT_EQ(a.begin()->first, 0);
+  EXPECT_EQ((--a.end())->first, 298);
+  EXPECT_EQ(b.begin()->first, 0);
+  b.clear();
+  a.try_emplace(1000, 1);
+  EXPECT_EQ((--a.end())->first, 1000);
+}
+// Distinct pools the nodes under node come from
+template <typename T, typename V>
+static void Pools(s21::Node<T, V>* node,
+                  std::set<const s21::NodePool<s21::Node<T, V>>*>& pools) {
+  if (node == nullptr) return;
+  pools.insert(node->pool);
+  Pools(node->left, pools);
+  Pools(node->right, pools);
+}
+TEST(mapTest, MergeFromTemporaries) {
+  using Map = s21::map<int, std::string>;
+  using Node = s21::Node<Map::value_type, std::string>;
+  using Pool = s21::NodePool<Node>;
+  const int n = 100000;
+  Map a;
+  for (int i = 0; i < 100; i++) a.insert(-i - 1, "a");
+  for (int i = 0; i < n; i++) {
+    // every node taken from a temporary keeps that temporary's pool alive
+    Map temp = {{i, "t"}};
+    if (i % 2 == 0) {
+      a.merge(temp);
+    } else {
+      EXPECT_TRUE(a.insert(temp.extract(i)).inserted);
+    }
+  }
+  ASSERT_EQ(a.size(), n + 100U);
+  std::set<const Pool*> pools;
+  Pools(a.get_tree().GetRoot(), pools);
+  size_t bytes = 0;
+  for (const Pool* pool : pools) bytes += pool->Bytes();
+  // a pinned pool must cost about a node, not a slab of them
+  EXPECT_LE(bytes / a.size(), 3 * sizeof(Node));
+  for (int i = 0; i < n; i += 3) a.erase(a.find(i));
+  EXPECT_EQ(a.at(-5), "a");
+  EXPECT_EQ(a.at(n - 2), "t");
+  EXPECT_EQ(a.size(), n + 100U - (n + 2) / 3);
+}
+TEST(setTest, SetAlgebraFromTemporaries) {
+  using Pool = s21::NodePool<s21::Node<int, int>>;
+  s21::set<int> a;
+  for (int i = 0; i < 100; i++) a.insert(i);
+  std::set<const Pool*> pools;
+  for (int round = 0; round < 20000; round++) {
+    s21::set<int> temp = {round % 100, 1000 + round % 7, 2000 + round};
+    a.set_union(temp);
+    // temp was consumed but keeps working with its own pool
+    temp.insert(2000 + round);
+    a.set_difference(temp);
+    if (round % 5 == 0) {
+      s21::set<int> high = a.split(1000);
+      a.set_union(high);
+    }
+    pools.clear();
+    Pools(a.get_tree().GetRoot(), pools);
+    ASSERT_LE(pools.size(), 8U);
+  }
+  EXPECT_EQ(a.size(), 107U);
+  EXPECT_EQ(*--a.end(), 1006);
+}
+// Moving, swapping, merging and extracting relink nodes, so even the
+// elements of tiny sets keep their addresses
+TEST(setTest, SmallSetsKeepAddresses) {
+  s21::set<std::string> a = {"a"};
+  s21::set<std::string> b = {"b"};
+  auto it = b.find("b");
+  const std::string* address = &*a.find("a");
+  a.merge(b);
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(&*a.find("b"), &*it);
+  s21::set<std::string> c(std::move(a));
+  c.swap(b);
+  EXPECT_EQ(&*b.find("a"), address);
+  auto node = b.extract("a");
+  EXPECT_EQ(&node.value(), address);
+  EXPECT_EQ(&*c.insert(std::move(node)).position, address);
+}
+template <typename S>
+static std::vector<int> Contents(S& s) {
+  std::vector<int> items(s.begin(), s.end());
+  if (!s.empty()) {
+    EXPECT_EQ(*--s.end(), items.back());
+  }
+  CheckAVL<int, int>(s.get_tree().GetRoot(), nullptr);
+  return items;
+}
+TEST(setTest, RelinkingMatchesStd) {
+  std::vector<s21::set<int>> sets(4);
+  std::vector<std::set<int>> expected(4);
+  unsigned seed = 99;
+  for (int step = 0; step < 4000; step++) {
+    seed = seed * 1103515245 + 12345;
+    unsigned r = seed >> 8;
+    size_t a = r % 4;
+    size_t b = (r >> 2) % 4;
+    int key = int(r >> 4) % 40;
+    switch ((r >> 10) % 8) {
+      case 0:
+      case 1:
+        sets[a].insert(key);
+        expected[a].insert(key);
+        break;
+      case 2:
+        sets[a].erase(sets[a].find(key));
+        expected[a].erase(key);
+        break;
+      case 3:
+        sets[a].swap(sets[b]);
+        std::swap(expected[a], expected[b]);
+        break;
+      case 4:
+        if (a != b) {
+          sets[a].merge(sets[b]);
+          expected[a].merge(expected[b]);
+          expected[b].clear();
+        }
+        break;
+      case 5:
+        if (a != b) {
+          sets[b] = sets[a].split(key);
+          expected[b] = {expected[a].lower_bound(key), expected[a].end()};
+          expected[a].erase(expected[a].lower_bound(key), expected[a].end());
+        }
+        break;
+      case 6: {
+        s21::set<int> temp(std::move(sets[a]));
+        sets[a] = std::move(temp);
+        break;
+      }
+      default:
+        if (expected[a].size() > 20) {
+          sets[a].clear();
+          expected[a].clear();
+        }
+    }
+    for (size_t i = 0; i < 4; i++) {
+      ASSERT_EQ(Contents(sets[i]),
+                std::vector<int>(expected[i].begin(), expected[i].end()));
+    }
+  }
+}
+TEST(mapTest, RangeAggregates) {
+  s21::augmented_map<int, long, s21::SumAggregate<long>> sums;
+  s21::augmented_map<int, int, s21::MinAggregate<int>> mins;
+  std::map<int, long> expected;
+  for (int i = 0; i < 2000; i++) {
+    int key = (i * 7919) % 613;
+    if (i % 4 == 3) {
+      sums.erase(sums.find(key));
+      mins.erase(mins.find(key));
+      expected.erase(key);
+    } else {
+      sums.insert_or_assign(key, long(i));
+      mins.insert_or_assign(key, i % 97);
+      expected[key] = i;
+    }
+  }
+  for (int lo = -5; lo < 620; lo += 37) {
+    for (int hi = lo; hi < 630; hi += 53) {
+      long sum = 0;
+      int min = std::numeric_limits<int>::max();
+      for (auto it = expected.lower_bound(lo);
+           it != expected.end() && it->first < hi; ++it) {
+        sum += it->second;
+        min = std::min(min, int(it->second % 97));
+      }
+      ASSERT_EQ(sums.aggregate(lo, hi), sum);
+      ASSERT_EQ(mins.aggregate(lo, hi), min);
+    }
+  }
+  long total = 0;
+  for (const auto& entry : expected) total += entry.second;
+  EXPECT_EQ(sums.aggregate(), total);
+  sums[1000] = 5;
+  sums.refresh(sums.find(1000));
+  EXPECT_EQ(sums.aggregate(), total + 5);
+  auto upper = sums.split(300);
+  EXPECT_EQ(sums.aggregate() + upper.aggregate(), total + 5);
+  sums.set_union(upper);
+  EXPECT_EQ(sums.aggregate(), total + 5);
+  EXPECT_EQ(sums.aggregate(1000, 1001), 5);
+}
 TEST(setTest, RotateCheck3) {
   s21::set<int> s1 = {5, 3, 7, 2, 4, 6, 8, 4, 6, 8, 9, 0, 1, 241325, 543565};
 }
+TEST(setTest, RankSelect) {
+  s21::set<int> s = {50, 10, 40, 20, 30};
+  EXPECT_EQ(s.rank(10), 0);
+  EXPECT_EQ(s.rank(30), 2);
+  EXPECT_EQ(s.rank(50), 4);
+  EXPECT_EQ(s.rank(35), s.size());
+  EXPECT_EQ(*s.select(0), 10);
+  EXPECT_EQ(*s.select(3), 40);
+  EXPECT_EQ(*s.nth(4), 50);
+  EXPECT_EQ(s.select(5), s.end());
+}
+TEST(setTest, CountLess) {
+  s21::set<int> s = {50, 10, 40, 20, 30};
+  EXPECT_EQ(s.count_less(5), 0);
+  EXPECT_EQ(s.count_less(10), 0);
+  EXPECT_EQ(s.count_less(35), 3);
+  EXPECT_EQ(s.count_less(100), 5);
+}
+TEST(setTest, SizeAfterRotations) {
+  s21::set<int> s;
+  std::set<int> std_s;
+  for (int i = 0; i < 1000; i++) {
+    int key = (i * 7919) % 1009;
+    s.insert(key);
+    std_s.insert(key);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    s.erase(s.find((i * 7919) % 1009));
+    std_s.erase((i * 7919) % 1009);
+  }
+  EXPECT_EQ(s.size(), std_s.size());
+  size_t k = 0;
+  for (auto i = std_s.begin(); i != std_s.end(); ++i, ++k) {
+    EXPECT_EQ(*s.select(k), *i);
+    EXPECT_EQ(s.rank(*i), k);
+  }
+}
+TEST(mapTest, RankSelect) {
+  s21::map<int, std::string> map = {{3, "three"}, {1, "one"}, {2, "two"}};
+  EXPECT_EQ(map.rank(1), 0);
+  EXPECT_EQ(map.rank(3), 2);
+  EXPECT_EQ(map.rank(4), map.size());
+  EXPECT_EQ(map.select(1)->second, "two");
+  EXPECT_EQ(map.nth(2)->first, 3);
+  EXPECT_EQ(map.select(3), map.end());
+  EXPECT_EQ(map.count_less(3), 2);
+  EXPECT_EQ(map.count_less(0), 0);
+}
 
 TEST(List, DefaultConstructor) {
   s21::list<int> s21_list;